@@ -0,0 +1,38 @@
+# --------------------------------
+#  SIMD kernels
+# --------------------------------
+#
+# Kernels using instruction set extensions are compiled in their own
+# source files with the flags needed for that extension. Which kernel
+# to run is decided at runtime by cpu feature detection (src/cpu.cpp),
+# so the library still runs on cpus without the extensions.
+
+if (CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|x86|i[3-6]86)$")
+	set( SIMD_X86_DEFAULT ON )
+else()
+	set( SIMD_X86_DEFAULT OFF )
+endif()
+
+option(WITH_SIMD "Build x86 SIMD kernels (selected at runtime)" ${SIMD_X86_DEFAULT})
+
+if (MSVC)
+	set( SIMD_SSE41_FLAGS "" )
+	set( SIMD_AVX2_FLAGS "/arch:AVX2" )
+	set( SIMD_AVX512_FLAGS "/arch:AVX512" )
+	set( SIMD_SHA_FLAGS "" )
+else()
+	set( SIMD_SSE41_FLAGS "-msse4.1" )
+	set( SIMD_AVX2_FLAGS "-mavx2" )
+	set( SIMD_AVX512_FLAGS "-mavx512f;-mavx512bw" )
+	set( SIMD_SHA_FLAGS "-msse4.1;-msha" )
+endif()
+
+# simd_sources(<target> <flags> <sources>...)
+#
+# Adds `sources` to `target` compiled with `flags`.
+function(simd_sources target flags)
+	target_sources( ${target} PRIVATE ${ARGN} )
+	if (flags)
+		set_source_files_properties( ${ARGN} PROPERTIES COMPILE_OPTIONS "${flags}" )
+	endif()
+endfunction()
@@ -25,7 +25,10 @@
 #define LIBEOSIO_WIF_H
 
 #include <string>
+#include <vector>
 #include <libeosio/ec.hpp>
+#include <libeosio/base58.hpp>
+#include <libeosio/checksum.hpp>
 
 namespace libeosio {
 
@@ -64,16 +67,59 @@ std::string wif_priv_encode(const ec_privkey_t& priv, const std::string& prefix
  * Decode an WIF String to EC private key
  */
 bool wif_priv_decode(ec_privkey_t& priv, const std::string& data);
+bool wif_priv_decode(ec_privkey_t& priv, const char* data, std::size_t size);
 
 /**
  * Encode an EC public key to WIF String.
  */
 std::string wif_pub_encode(const ec_pubkey_t& pub, const std::string& prefix = WIF_PUB_K1);
 
+/**
+ * Size of an output slot for wif_pub_encode_batch() (including the NUL terminator)
+ */
+inline std::size_t wif_pub_encoded_size(const std::string& prefix = WIF_PUB_K1) {
+	return prefix.size() + base58_encoded_size(EC_PUBKEY_SIZE + CHECKSUM_SIZE) + 1;
+}
+
+/**
+ * Encode `count` EC public keys to WIF Strings.
+ *
+ * The string for `keys[k]` is written NUL terminated to `out + k * stride`.
+ * `stride` must be atleast wif_pub_encoded_size(prefix).
+ *
+ * Returns false if `stride` is to small.
+ */
+bool wif_pub_encode_batch(const ec_pubkey_t* keys, std::size_t count,
+	char* out, std::size_t stride, const std::string& prefix = WIF_PUB_K1);
+
+/**
+ * Closed interval [first, last] of public keys.
+ */
+typedef struct {
+	ec_pubkey_t first;
+	ec_pubkey_t last;
+} wif_pub_range_t;
+
+/**
+ * Compute the ranges of public keys whose WIF string starts with `prefix` directly
+ * after the key prefix (eg. "EOS" or "PUB_K1_").
+ *
+ * A candidate key can then be checked with a plain compare (`first <= key && key <= last`)
+ * without hashing or encoding it. The ranges are the same for all key prefixes.
+ *
+ * The checksum that follows the key is not known in advance, so the result is exact
+ * except for the `first` and `last` key of each range: whether they match depends on
+ * their checksum and they must be confirmed with wif_pub_encode().
+ *
+ * Returns false if `prefix` is not valid (see base58_prefix_ranges()).
+ */
+bool wif_pub_prefix_ranges(const std::string& prefix, std::vector<wif_pub_range_t>& ranges);
+
 /**
  * Decode an WIF String to EC public key
  */
 bool wif_pub_decode(ec_pubkey_t& pub, const std::string& data);
+bool wif_pub_decode(ec_pubkey_t& pub, const char* data, std::size_t size);
 
 /**
  * Prints an EC keypair in WIF format to standard out.
@@ -93,6 +139,7 @@ std::string wif_sig_encode(const ec_signature_t& sig);
  * Decode an WIF String to EC signature
  */
 bool wif_sig_decode(ec_signature_t& sig, const std::string& data);
+bool wif_sig_decode(ec_signature_t& sig, const char* data, std::size_t size);
 
 } // namespace libeosio
 
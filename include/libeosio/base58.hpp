@@ -24,11 +24,27 @@
 #ifndef LIBEOSIO_BASE58_H
 #define LIBEOSIO_BASE58_H
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
 namespace libeosio {
 
+/**
+ * Returns the maximum number of characters needed to base58 encode `len` bytes.
+ */
+inline std::size_t base58_encoded_size(std::size_t len) {
+	return len * 138 / 100 + 1; // log(256) / log(58), rounded up.
+}
+
+/**
+ * Returns the maximum number of bytes that `len` base58 characters can decode to,
+ * not counting leading '1's. Each of those decodes to a zero byte of its own.
+ */
+inline std::size_t base58_decoded_size(std::size_t len) {
+	return len * 733 / 1000 + 1; // log(58) / log(256), rounded up.
+}
+
 /**
  * Base58 Encoding functions.
  */
@@ -36,12 +52,87 @@ std::string base58_encode(const std::string& str);
 std::string base58_encode(const std::vector<unsigned char>& vch);
 std::string base58_encode(const unsigned char* pbegin, const unsigned char* pend);
 
+/**
+ * Encode `len` bytes from `data` into the caller provided buffer `out`.
+ * No memory is allocated and no NUL terminator is written.
+ *
+ * `outlen` must be set to the capacity of `out`, on success it is set to the
+ * number of characters written and true is returned.
+ *
+ * If the result does not fit in `out`, false is returned and `outlen` is set to
+ * base58_encoded_size(len). A buffer of that size is always large enough.
+ */
+bool base58_encode(const unsigned char* data, std::size_t len, char* out, std::size_t& outlen);
+
+
+/**
+ * No limit on the decoded size.
+ */
+#define BASE58_DECODE_UNBOUNDED ((std::size_t) -1)
+
+/**
+ * Batch encode `count` payloads of `len` bytes each, stored back to back in `data`.
+ *
+ * Payloads are encoded several at a time, one per SIMD lane, which is a lot faster
+ * than calling base58_encode() in a loop when there are many of them.
+ *
+ * The string for payload `k` is written NUL terminated to `out + k * stride`.
+ * `stride` must be greater than base58_encoded_size(len).
+ * If `lengths` is not NULL, the length of each string is stored in `lengths[k]`.
+ *
+ * Returns false if `stride` is to small.
+ */
+bool base58_encode_batch(const unsigned char* data, std::size_t len, std::size_t count,
+	char* out, std::size_t stride, std::size_t* lengths = NULL);
 
 /**
  * Base58 Decoding functions.
+ *
+ * `max` is the maximum number of bytes the result may have. Input that would decode
+ * to more than `max` bytes is rejected before any decoding work is done, so the cost
+ * of decoding is bounded by `max` and not by the length of the input.
  */
 bool base58_decode(const char* psz, std::vector<unsigned char>& out);
-bool base58_decode(const std::string& str, std::vector<unsigned char>& out);
+bool base58_decode(const std::string& str, std::vector<unsigned char>& out, std::size_t max = BASE58_DECODE_UNBOUNDED);
+bool base58_decode(const char* str, std::size_t len, std::vector<unsigned char>& out, std::size_t max = BASE58_DECODE_UNBOUNDED);
+
+/**
+ * Decode `len` characters from `str` (does not need to be NUL terminated) into the
+ * caller provided buffer `out`. No memory is allocated.
+ * Leading and trailing whitespace is ignored.
+ *
+ * The capacity of `out` is also the maximum decoded size. Input with more characters
+ * than can fit in the capacity is rejected up front (see above).
+ *
+ * `outlen` must be set to the capacity of `out`, on success it is set to the
+ * number of bytes written and true is returned.
+ *
+ * False is returned if `str` is not valid base58 or if the result does not fit in `out`.
+ * In the latter case `outlen` is set to the number of leading '1's plus
+ * base58_decoded_size() of the other characters. A buffer of that size is always
+ * large enough. `outlen` is not changed if `str` is not valid base58.
+ */
+bool base58_decode(const char* str, std::size_t len, unsigned char* out, std::size_t& outlen);
+
+/**
+ * Closed interval [first, last] of big-endian numbers.
+ */
+typedef struct {
+	std::vector<unsigned char> first;
+	std::vector<unsigned char> last;
+} base58_range_t;
+
+/**
+ * Compute the ranges of `len` byte payloads whose base58 encoding starts with `prefix`.
+ *
+ * A payload matches if it is inside one of the ranges (compared as big-endian numbers,
+ * eg. with memcmp). Different encoded lengths give different ranges, they are stored
+ * in ascending order in `ranges`, which is empty if no payload can match.
+ *
+ * Returns false if `prefix` is empty, contains non-base58 characters or starts with
+ * '1' (which encodes a leading zero byte rather than a value).
+ */
+bool base58_prefix_ranges(const std::string& prefix, std::size_t len, std::vector<base58_range_t>& ranges);
 
 /**
  * Returns true if `ch` is a base58 character, false otherwise.
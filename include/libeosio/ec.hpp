@@ -80,10 +80,211 @@ struct ec_keypair {
  */
 typedef std::array<unsigned char, EC_SIGNATURE_SIZE> ec_signature_t;
 
+/**
+ * Default for ec_context::set_randomize_interval().
+ */
+#define EC_RANDOMIZE_INTERVAL 1024
+
+/**
+ * Elliptic curve backends
+ *
+ * The library is built with libsecp256k1, OpenSSL or both (cmake EC_LIB=libsecp256k1,
+ * openssl or all). With both, contexts use the backend selected with ec_init() or the
+ * LIBEOSIO_EC_BACKEND environment variable ("libsecp256k1" or "openssl"), otherwise
+ * libsecp256k1. A backend that fails its self-test is not selected, another one is
+ * used instead.
+ */
+typedef enum {
+	EC_BACKEND_DEFAULT,       // The selected backend.
+	EC_BACKEND_LIBSECP256K1,
+	EC_BACKEND_OPENSSL,
+} ec_backend_t;
+
+/**
+ * Returns the name of `backend`, NULL if it is unknown.
+ */
+const char* ec_backend_name(ec_backend_t backend);
+
+/**
+ * Returns true if `backend` is compiled in and passes its self-test.
+ */
+bool ec_backend_available(ec_backend_t backend);
+
+/**
+ * Returns the selected backend.
+ */
+ec_backend_t ec_get_backend();
+
+/**
+ * Prepared public key
+ *
+ * A public key parsed once for repeated ecdsa_verify_prepared() calls, which saves
+ * decompressing the point on every verification. With `precompute` a table of multiples
+ * of the point is built as well (16 KB with libsecp256k1) so verifications need fewer
+ * point additions, worth it for keys that verify many signatures. The OpenSSL
+ * implementation ignores `precompute`. A key prepared by another backend than the one
+ * of the verifying context works like an unprepared one.
+ *
+ * A prepared key is not modified by verifications, so several threads can use it at once.
+ */
+class ec_pubkey_prepared {
+public:
+	ec_pubkey_prepared(ec_backend_t backend = EC_BACKEND_DEFAULT);
+	~ec_pubkey_prepared();
+
+	ec_pubkey_prepared(const ec_pubkey_prepared&) = delete;
+	ec_pubkey_prepared& operator=(const ec_pubkey_prepared&) = delete;
+
+	/**
+	 * Prepare `key`, returns -1 if it is not a valid public key.
+	 */
+	int set(const ec_pubkey_t& key, bool precompute = false);
+
+	bool valid() const;
+	const ec_pubkey_t& key() const;
+
+	// Implementation state.
+	struct impl;
+
+private:
+	friend class ec_context;
+	impl *p;
+};
+
+/**
+ * Elliptic curve context
+ *
+ * Owns the state of the elliptic curve implementation (precomputed tables, blinding,
+ * scratch space). Every method has the same contract as the free function with the
+ * same name below.
+ *
+ * A context must only be used by one thread at a time, so threads that work on keys
+ * or signatures in parallel each use their own context. The free functions do that
+ * by using a per thread default context (see ec_default_context()).
+ *
+ * A context uses one backend for its whole life, `backend` defaults to the selected one.
+ */
+class ec_context {
+public:
+	ec_context(ec_backend_t backend = EC_BACKEND_DEFAULT);
+	~ec_context();
+
+	ec_context(const ec_context&) = delete;
+	ec_context& operator=(const ec_context&) = delete;
+
+	/**
+	 * Returns false if the implementation state could not be created,
+	 * all methods fail in that case.
+	 */
+	bool valid() const;
+
+	/**
+	 * The backend of this context.
+	 */
+	ec_backend_t backend() const;
+
+	/**
+	 * Renew the side channel blinding of the implementation after every `keys`
+	 * generated private keys (0: only when the context is created). Implementations
+	 * that blind every operation on their own ignore this.
+	 */
+	void set_randomize_interval(std::size_t keys);
+
+	int generate_privkey(ec_privkey_t *priv);
+	int get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub);
+	int generate_key(struct ec_keypair *pair);
+	int generate_keys_sequential(struct ec_keypair *pairs, std::size_t count);
+	int derive_keys_sequential(const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count);
+
+	int sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig);
+	int verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key);
+	int verify_batch(const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid = nullptr);
+	int verify_prepared(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_prepared& key);
+	int recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key);
+
+	// Implementation state.
+	struct impl;
+
+private:
+	friend class ec_signer;
+	impl *p;
+};
+
+/**
+ * Signer
+ *
+ * Signs with one private key that is loaded once, for callers that sign many digests
+ * with the same key. The key is validated and its public key computed when it is set,
+ * each signature then only costs the signing itself and allocates no memory with
+ * libsecp256k1. With libsecp256k1 the nonces are deterministic (RFC 6979), so the
+ * signatures are the same as ecdsa_sign() would make. OpenSSL uses random nonces.
+ *
+ * A signer has its own context, so like a context it must only be used by one thread
+ * at a time.
+ */
+class ec_signer {
+public:
+	ec_signer(ec_backend_t backend = EC_BACKEND_DEFAULT);
+	~ec_signer();
+
+	ec_signer(const ec_signer&) = delete;
+	ec_signer& operator=(const ec_signer&) = delete;
+
+	/**
+	 * Load `key`, returns -1 if it is not a valid private key.
+	 */
+	int set_key(const ec_privkey_t& key);
+
+	/**
+	 * Returns false until a key is loaded or if the context could not be created.
+	 */
+	bool valid() const;
+
+	const ec_pubkey_t& pubkey() const;
+
+	/**
+	 * Same as ecdsa_sign() with the loaded key.
+	 */
+	int sign(const sha256_t* digest, ec_signature_t& sig);
+
+	/**
+	 * Sign `count` digests, `sigs[i]` is the signature of `digests[i]`.
+	 * Returns -1 if one of them could not be signed.
+	 */
+	int sign_many(const sha256_t* digests, std::size_t count, ec_signature_t* sigs);
+
+	// Implementation state.
+	struct impl;
+
+private:
+	impl *p;
+};
+
+/**
+ * The default context of the calling thread, created on first use.
+ * The reference stays valid until the thread exits, calls ec_shutdown() or another
+ * backend is selected.
+ */
+ec_context& ec_default_context();
+
 /**
  * Initialize the ec library.
+ *
+ * Selects `backend` for all threads and creates the default context of the calling
+ * thread. EC_BACKEND_DEFAULT selects the backend named by LIBEOSIO_EC_BACKEND, or
+ * libsecp256k1. If that backend is not compiled in or fails its self-test, another one
+ * is selected (see ec_get_backend()).
+ *
+ * Optional, the free functions select the default backend and create the context on
+ * first use. Returns -1 if no backend could be selected or the context could not be
+ * created.
+ */
+int ec_init(ec_backend_t backend = EC_BACKEND_DEFAULT);
+
+/**
+ * The free functions below use the default context of the calling thread,
+ * so they can be called from several threads at once.
  */
-int ec_init();
 
 /**
  * Generates an new random private key using the secp256k1 curve.
@@ -101,6 +302,30 @@ int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub);
  */
 int ec_generate_key(struct ec_keypair *pair);
 
+/**
+ * Sequential key generation
+ *
+ * Generates `count` keypairs in `pairs` whose secrets are k, k + 1, k + 2, ... for a
+ * random k. Each public key is the previous one plus G and batches of points share a
+ * single field inversion, so a key costs about one point addition instead of a full
+ * scalar multiplication.
+ *
+ * The keys are related: anyone holding one of the secrets can compute all the others.
+ * Only use this where at most one key of a run is kept (vanity search) or all keys
+ * belong to the same owner.
+ */
+int ec_generate_keys_sequential(struct ec_keypair *pairs, std::size_t count);
+
+/**
+ * Same as ec_generate_keys_sequential() but from a known secret, `pairs[i]` gets the
+ * secret base + offset + i. Generating a range in several calls with increasing
+ * offsets gives the same keys as one call.
+ *
+ * Returns -1 if base is not a valid private key or a secret in the range wraps
+ * around to zero.
+ */
+int ec_derive_keys_sequential(const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count);
+
 
 /**
  * Sign
@@ -117,14 +342,55 @@ int ecdsa_sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t&
  */
 int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key);
 
+/**
+ * Verify an ECDSA signature with a prepared public key, same result as ecdsa_verify()
+ * with the key given to ec_pubkey_prepared::set(). Returns -1 if the key is not valid.
+ */
+int ecdsa_verify_prepared(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_prepared& key);
+
+/**
+ * Batch verification
+ *
+ * Verifies `count` signatures, `sigs[i]` of `digests[i]` by `keys[i]`. Returns zero if
+ * all signatures are correct, -1 if at least one is incorrect or an error occured.
+ *
+ * With libsecp256k1 the signatures are checked together, a few hundred at a time, with
+ * one randomized multi scalar multiplication which is several times faster than
+ * verifying them one by one. A batch that fails is verified again one signature at a
+ * time to find the bad ones, so the result is the same as calling ecdsa_verify() on
+ * each signature. When `valid` is not NULL `valid[i]` tells if signature i is correct,
+ * otherwise the call returns at the first incorrect signature.
+ */
+int ecdsa_verify_batch(const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid = nullptr);
+
 /**
  * Recover the public key from the signature.
  * returns zero if the public key could be extracted. -1 if an error occured.
  */
 int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key);
 
+/**
+ * Batch recovery
+ *
+ * Recovers the public keys of `count` signatures, `keys[i]` from `sigs[i]` of `digests[i]`.
+ * The signatures are split between `threads` threads (0 means one per cpu): the calling
+ * thread and workers from a pool that is started on first use and kept for the life of the
+ * process. Each thread uses its own default context, which the workers keep between calls.
+ * Small batches stay on the calling thread.
+ *
+ * `status[i]` is set to 0 if key i was recovered or -1 if not, in which case `keys[i]`
+ * is zero filled. Returns 0 if all keys were recovered, -1 otherwise.
+ */
+int ecdsa_recover_batch(const sha256_t* digests, const ec_signature_t* sigs, std::size_t count,
+	ec_pubkey_t* keys, int* status, unsigned int threads = 0);
+
 /**
  * Shutdown the ec library.
+ *
+ * Destroys the default context of the calling thread (a new one is created if the
+ * thread uses the free functions again). Contexts of other threads are destroyed
+ * when those threads exit, the worker threads used by ecdsa_recover_batch() keep
+ * theirs for the life of the process.
  */
 void ec_shutdown();
 
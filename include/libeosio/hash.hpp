@@ -25,6 +25,7 @@
 #define LIBEOSIO_HASH_H
 
 #include <cstddef>
+#include <cstdint>
 
 namespace libeosio {
 
@@ -55,6 +56,54 @@ sha256_t* sha256d(const unsigned char *data, std::size_t len, sha256_t* out);
  */
 ripemd160_t* ripemd160(const unsigned char *data, std::size_t len, ripemd160_t* out);
 
+/**
+ * Batch hashing
+ *
+ * Hashes `count` independent messages, message `i` is `len[i]` bytes at `data[i]`
+ * and its hash is stored in `out[i]`. Messages are hashed several at a time in the
+ * SIMD lanes of the cpu (4 with SSE4.1, 8 with AVX2, 16 with AVX-512) and may have
+ * different lengths.
+ * Falls back to hashing one message after the other when that is faster.
+ */
+void sha256_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, sha256_t* out);
+void sha256d_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, sha256_t* out);
+void ripemd160_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, ripemd160_t* out);
+
+/**
+ * Incremental hashing
+ *
+ * Hash data that is not stored in one piece without copying it first:
+ *
+ *   sha256_ctx_t ctx;
+ *   sha256_init(&ctx);
+ *   sha256_update(&ctx, a, a_len);
+ *   sha256_update(&ctx, b, b_len);
+ *   sha256_final(&ctx, &hash);
+ *
+ * Contexts are plain structs that can live on the stack. They can be copied to
+ * reuse a partially hashed state (eg. a common prefix) for several messages.
+ * A context must be initialized again after *_final() has been called on it.
+ */
+typedef struct {
+	uint32_t state[8];
+	uint64_t count;
+	unsigned char buf[64];
+} sha256_ctx_t;
+
+typedef struct {
+	uint32_t state[5];
+	uint64_t count;
+	unsigned char buf[64];
+} ripemd160_ctx_t;
+
+void sha256_init(sha256_ctx_t* ctx);
+void sha256_update(sha256_ctx_t* ctx, const unsigned char *data, std::size_t len);
+sha256_t* sha256_final(sha256_ctx_t* ctx, sha256_t* out);
+
+void ripemd160_init(ripemd160_ctx_t* ctx);
+void ripemd160_update(ripemd160_ctx_t* ctx, const unsigned char *data, std::size_t len);
+ripemd160_t* ripemd160_final(ripemd160_ctx_t* ctx, ripemd160_t* out);
+
 } // namespace libeosio
 
 #endif /* LIBEOSIO_HASH_H */
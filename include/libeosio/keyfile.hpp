@@ -0,0 +1,78 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_KEYFILE_H
+#define LIBEOSIO_KEYFILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <libeosio/ec.hpp>
+
+namespace libeosio {
+
+/**
+ * Key files
+ *
+ * Decode newline separated WIF strings (one key or signature per line) into a
+ * contiguous array, using a pool of worker threads.
+ *
+ * Element `i` of the output holds the value decoded from line `i`. Lines that
+ * fails to decode (including empty lines) are zero filled and have their bit
+ * cleared in the status bitmap.
+ *
+ * `threads` is the number of worker threads to use, 0 means one per cpu.
+ */
+
+/**
+ * Per line status bitmap. bit `i % 64` of word `i / 64` is set if line `i` was decoded.
+ */
+typedef std::vector<uint64_t> wif_status_t;
+
+inline bool wif_status_ok(const wif_status_t& status, std::size_t line) {
+	return (status[line / 64] >> (line % 64)) & 1;
+}
+
+/**
+ * Decode all lines in a memory buffer.
+ */
+void wif_pub_decode_lines(const char* data, std::size_t size, std::vector<ec_pubkey_t>& keys,
+	wif_status_t& status, unsigned int threads = 0);
+
+void wif_sig_decode_lines(const char* data, std::size_t size, std::vector<ec_signature_t>& sigs,
+	wif_status_t& status, unsigned int threads = 0);
+
+/**
+ * Decode all lines in a file. The file is memory mapped if possible.
+ *
+ * Returns 0 on success or -1 if the file could not be read.
+ */
+int wif_pub_decode_file(const std::string& filename, std::vector<ec_pubkey_t>& keys,
+	wif_status_t& status, unsigned int threads = 0);
+
+int wif_sig_decode_file(const std::string& filename, std::vector<ec_signature_t>& sigs,
+	wif_status_t& status, unsigned int threads = 0);
+
+} // namespace libeosio
+
+#endif /* LIBEOSIO_KEYFILE_H */
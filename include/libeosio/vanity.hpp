@@ -0,0 +1,263 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_VANITY_H
+#define LIBEOSIO_VANITY_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <libeosio/ec.hpp>
+#include <libeosio/WIF.hpp>
+
+namespace libeosio {
+
+/**
+ * Vanity key search
+ *
+ * Searches for keypairs whose WIF encoded public key contains one of a set of patterns,
+ * using one worker thread per cpu (or as many as asked for).
+ *
+ * The search runs through the secrets base, base + 1, base + 2, ... (see
+ * ec_derive_keys_sequential()) in chunks of VANITY_CHUNK_KEYS keys. Idle workers take
+ * the next unsearched chunk from a shared cursor, so a slow or descheduled worker never
+ * holds up the others and no part of the sequence is searched twice. Every worker has
+ * its own ec_context and is pinned to a cpu of its own.
+ *
+ * As all keys of a search derive from the same base, every found key reveals the others
+ * found by the same search. Only keep one key per search, or give them all to the same
+ * owner.
+ */
+
+/**
+ * Keys derived and checked by a worker at a time.
+ */
+#define VANITY_CHUNK_KEYS 4096
+
+/**
+ * Where a pattern must appear in the base58 part of the public key (after the codec prefix).
+ */
+typedef enum {
+	VANITY_PREFIX,    // First characters, eg. "EOS<pattern>..."
+	VANITY_ANYWHERE,
+	VANITY_SUFFIX,    // Last characters (part of the checksum).
+} vanity_position_t;
+
+/**
+ * Pattern flags
+ *
+ * VANITY_IGNORE_CASE: letters match in upper or lower case ("eos" matches "EoS"). Letters
+ * without a base58 counterpart only match in the other case, eg. 'l' as 'L'.
+ *
+ * VANITY_LEET: digits match the letter they look like: 4 a, 8 b, 3 e, 6 and 9 g, 1 i,
+ * 0 o, 5 s, 7 t and 2 z ("b33s" and "8ee5" both match "bees").
+ */
+#define VANITY_IGNORE_CASE 0x1
+#define VANITY_LEET        0x2
+
+typedef struct {
+	std::string text;
+	vanity_position_t position;
+	unsigned int flags;
+} vanity_pattern_t;
+
+/**
+ * Multi pattern matcher
+ *
+ * Compiles the patterns into Aho-Corasick automatons over the base58 alphabet, so a key
+ * is checked in a single pass over its characters no matter how many patterns there are.
+ * Patterns with the same flags share an automaton, case and leet variants are handled by
+ * folding the input before each transition instead of adding states for them.
+ *
+ * match() does not modify the matcher, so one matcher can be used by several threads.
+ */
+class vanity_matcher {
+public:
+	vanity_matcher();
+	~vanity_matcher();
+
+	vanity_matcher(const vanity_matcher&) = delete;
+	vanity_matcher& operator=(const vanity_matcher&) = delete;
+
+	/**
+	 * Replace the patterns of the matcher.
+	 *
+	 * Returns false (and matches nothing) if there are no patterns or a pattern can never
+	 * match: empty, longer than a key or with a character that is not base58 (after case
+	 * and leet folding).
+	 */
+	bool compile(const std::vector<vanity_pattern_t>& patterns);
+
+	/**
+	 * Match the base58 part of a public key (without the key prefix).
+	 *
+	 * Returns the index of the first pattern, in the order they were compiled, that
+	 * matches `str`. -1 if none does.
+	 */
+	int match(const char *str, std::size_t len) const;
+
+	int match(const std::string& str) const {
+		return match(str.data(), str.size());
+	}
+
+	// Compiled automatons, defined by the implementation.
+	struct impl;
+
+private:
+	impl *p;
+};
+
+/**
+ * A found key.
+ */
+typedef struct {
+	struct ec_keypair key;
+	std::string pub;        // WIF encoded public key.
+	std::size_t pattern;    // Index of the pattern that matched.
+	uint64_t index;         // Key is base + index.
+} vanity_match_t;
+
+typedef struct {
+	uint64_t keys;          // Keys checked.
+	uint64_t matches;
+	double seconds;         // Since the search started.
+	double kps;             // Keys per second over the last progress interval
+	                        // (over the whole run once it has finished).
+} vanity_stats_t;
+
+class vanity_search {
+public:
+	// Return false to stop the search.
+	typedef std::function<bool(const vanity_match_t&)> match_fn;
+	typedef std::function<void(const vanity_stats_t&)> progress_fn;
+
+	vanity_search(const std::vector<vanity_pattern_t>& patterns, const wif_codec_t& codec = WIF_CODEC_K1);
+	~vanity_search();
+
+	vanity_search(const vanity_search&) = delete;
+	vanity_search& operator=(const vanity_search&) = delete;
+
+	/**
+	 * Settings, must not be changed while the search is running.
+	 */
+
+	// Number of worker threads, 0 means one per cpu (default).
+	void set_threads(unsigned int threads);
+
+	// Pin worker `i` to the `i`:th cpu (default on).
+	void set_pin_threads(bool pin);
+
+	// First secret of the sequence, a random key is used if not set.
+	// Starts a new sequence, forgetting the progress and matches of earlier runs.
+	void set_base(const ec_privkey_t& base);
+
+	// Stop conditions, 0 means no limit (default). Keys and matches count from the
+	// start of the sequence (including earlier runs), the timeout is per run.
+	void set_max_keys(uint64_t keys);
+	void set_max_matches(uint64_t matches);
+	void set_timeout(double seconds);
+
+	/**
+	 * Called for every found key, from the worker that found it.
+	 * Calls are serialized, only one runs at a time.
+	 */
+	void on_match(match_fn fn);
+
+	/**
+	 * Called every `interval` seconds from the thread that called run().
+	 */
+	void on_progress(progress_fn fn, double interval = 1.0);
+
+	/**
+	 * Run the search, returns when a stop condition is met, a match callback returned
+	 * false or cancel() was called. Calling run() again continues the same sequence
+	 * where the last run (or the loaded checkpoint) stopped.
+	 *
+	 * Returns -1 if a pattern can never match (see vanity_matcher::compile(), and
+	 * prefixes without flags no key starts with), a worker failed or a checkpoint could
+	 * not be saved. Zero otherwise.
+	 */
+	int run();
+
+	/**
+	 * Stop a running search. Safe to call from any thread and from the callbacks.
+	 */
+	void cancel();
+
+	/**
+	 * Statistics of the current (or last) run.
+	 */
+	vanity_stats_t stats() const;
+
+	/**
+	 * Keys found so far, in the order they were found.
+	 */
+	std::vector<vanity_match_t> matches() const;
+
+	/**
+	 * First secret of the sequence used by the current (or last) run.
+	 */
+	const ec_privkey_t& base() const;
+
+	/**
+	 * Checkpoints
+	 *
+	 * A checkpoint holds what is needed to continue a search: the base, which parts of
+	 * the sequence are done, the statistics and the found keys. It can be resumed on
+	 * another machine and with another number of threads without searching any part of
+	 * the sequence twice. Chunks that were in progress are searched again, but keys
+	 * they already reported are not reported again.
+	 *
+	 * The file holds the base and the found private keys, keep it as safe as the keys.
+	 */
+
+	/**
+	 * Save a checkpoint to `filename` every `interval` seconds while running and when
+	 * run() returns.
+	 */
+	void set_checkpoint(const std::string& filename, double interval = 60.0);
+
+	/**
+	 * Save a checkpoint now. Can be called while the search is running, from any thread.
+	 * Returns 0 on success, -1 if the file could not be written.
+	 */
+	int save_checkpoint(const std::string& filename) const;
+
+	/**
+	 * Continue from a checkpoint, must be called before run().
+	 * Returns -1 if the file could not be read, is corrupt or was saved by a search
+	 * with other patterns or another key prefix.
+	 */
+	int load_checkpoint(const std::string& filename);
+
+	// Search state, defined by the implementation.
+	struct impl;
+
+private:
+	impl *p;
+};
+
+} // namespace libeosio
+
+#endif /* LIBEOSIO_VANITY_H */
@@ -26,6 +26,8 @@
 #include <libeosio/base58.hpp>
 #include <libeosio/checksum.hpp>
 #include <libeosio/WIF.hpp>
+#include "base58/batch.hpp"
+#include "base58/fixed.hpp"
 #include "wif/codec.hpp"
 
 namespace libeosio {
@@ -39,32 +41,65 @@ const std::string WIF_SIG_K1  = "SIG_K1_";
 const wif_codec_t WIF_CODEC_K1  = { WIF_PUB_K1, WIF_PVT_K1 };
 const wif_codec_t WIF_CODEC_LEG = wif_create_legacy_codec(WIF_PUB_LEG);
 
+// Encodes a `N` byte payload with the fixed width base58 engine and prepends `prefix`.
+template <std::size_t N>
+static std::string _encode(const std::string& prefix, const unsigned char* buf) {
+
+	char out[internal::base58_fixed<N>::max_size];
+	std::size_t len = internal::base58_fixed<N>::encode(buf, out);
+	std::string str;
+
+	str.reserve(prefix.size() + len);
+	str.append(prefix).append(out, len);
+	return str;
+}
+
+// Returns true if `data` starts with `prefix`.
+static bool _has_prefix(const char* data, std::size_t size, const std::string& prefix) {
+	return size >= prefix.size() && !std::memcmp(data, prefix.data(), prefix.size());
+}
+
+// Decodes the base58 part of `data` (starting at `offset`) into `buf`.
+// `len` is the capacity of `buf` and is set to the decoded length.
+static bool _decode(const char* data, std::size_t size, std::size_t offset, unsigned char* buf, std::size_t& len) {
+
+	if (offset > size) {
+		return false;
+	}
+
+	// Bounded by the payload size, so oversized input is rejected without decoding it.
+	return base58_decode(data + offset, size - offset, buf, len);
+}
+
 std::string wif_priv_encode(const ec_privkey_t& priv, const std::string& prefix) {
 
-	checksum_t check;
 	// 1 byte extra for legacy prefix prefix.
 	unsigned char buf[1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE] = { 0 };
-	size_t len;
 
 	if (prefix == WIF_PVT_K1) {
-		len = internal::priv_encoder_k1(priv, buf);
+		internal::priv_encoder_k1(priv, buf);
+		return _encode<EC_PRIVKEY_SIZE + CHECKSUM_SIZE>(prefix, buf);
 	} else if (prefix == WIF_PVT_LEG) {
-		len = internal::priv_encoder_legacy(priv, buf);
-	} else {
-		return "";
+		internal::priv_encoder_legacy(priv, buf);
+		return _encode<1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE>(prefix, buf);
 	}
 
-	return prefix + base58_encode(buf, buf + len);
+	return "";
 }
 
 bool wif_priv_decode(ec_privkey_t& priv, const std::string& data) {
+	return wif_priv_decode(priv, data.data(), data.size());
+}
+
+bool wif_priv_decode(ec_privkey_t& priv, const char* data, std::size_t size) {
 
 	uint8_t offset;
-	std::vector<unsigned char> buf;
+	unsigned char buf[1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE];
+	std::size_t len = sizeof(buf);
 	internal::priv_decoder_t decoder = internal::priv_decoder_legacy;
 
 	// Check prefix
-	if (data.substr(0, WIF_PVT_K1.size()) == WIF_PVT_K1) {
+	if (_has_prefix(data, size, WIF_PVT_K1)) {
 		offset = WIF_PVT_K1.size();
 		decoder = internal::priv_decoder_k1;
 	} else {
@@ -72,11 +107,11 @@ bool wif_priv_decode(ec_privkey_t& priv, const std::string& data) {
 		offset = 0;
 	}
 
-	if (!base58_decode(data.c_str() + offset, buf)) {
+	if (!_decode(data, size, offset, buf, len)) {
 		return false;
 	}
 
-	return decoder(buf, priv);
+	return decoder(buf, len, priv);
 }
 
 std::string wif_pub_encode(const ec_pubkey_t& pub, const std::string& prefix) {
@@ -94,17 +129,89 @@ std::string wif_pub_encode(const ec_pubkey_t& pub, const std::string& prefix) {
 
 	encoder(pub, buf);
 
-	return prefix + base58_encode(buf, buf + sizeof(buf));
+	return _encode<sizeof(buf)>(prefix, buf);
+}
+
+bool wif_pub_encode_batch(const ec_pubkey_t* keys, std::size_t count,
+	char* out, std::size_t stride, const std::string& prefix) {
+
+	unsigned char buf[BASE58_BATCH_LANES][EC_PUBKEY_SIZE + CHECKSUM_SIZE];
+	internal::pub_batch_encoder_t encoder;
+	const std::size_t plen = prefix.size();
+
+	if (stride < wif_pub_encoded_size(prefix)) {
+		return false;
+	}
+
+	if (prefix == WIF_PUB_K1) {
+		encoder = internal::pub_batch_encoder_k1;
+	}
+	// Legacy
+	else {
+		encoder = internal::pub_batch_encoder_legacy;
+	}
+
+	for (std::size_t i = 0; i < count; i += BASE58_BATCH_LANES) {
+		std::size_t n = count - i < BASE58_BATCH_LANES ? count - i : BASE58_BATCH_LANES;
+
+		encoder(keys + i, n, buf[0], sizeof(buf[0]));
+		for (std::size_t k = 0; k < n; k++) {
+			std::memcpy(out + (i + k) * stride, prefix.data(), plen);
+		}
+
+		base58_encode_batch(buf[0], sizeof(buf[0]), n, out + i * stride + plen, stride);
+	}
+
+	return true;
+}
+
+bool wif_pub_prefix_ranges(const std::string& prefix, std::vector<wif_pub_range_t>& ranges) {
+
+	std::vector<base58_range_t> payload;
+
+	ranges.clear();
+	if (!base58_prefix_ranges(prefix, EC_PUBKEY_SIZE + CHECKSUM_SIZE, payload)) {
+		return false;
+	}
+
+	for (std::size_t i = 0; i < payload.size(); i++) {
+		wif_pub_range_t r;
+
+		// Drop the checksum, the key is the most significant part of the payload.
+		std::memcpy(r.first.data(), payload[i].first.data(), EC_PUBKEY_SIZE);
+		std::memcpy(r.last.data(), payload[i].last.data(), EC_PUBKEY_SIZE);
+
+		// Compressed keys start with 0x02 or 0x03.
+		if (r.first[0] < 0x02) {
+			r.first.fill(0);
+			r.first[0] = 0x02;
+		}
+		if (r.last[0] > 0x03) {
+			r.last.fill(0xff);
+			r.last[0] = 0x03;
+		}
+
+		if (r.first <= r.last) {
+			ranges.push_back(r);
+		}
+	}
+
+	return true;
 }
 
 bool wif_pub_decode(ec_pubkey_t& pub, const std::string& data) {
+	return wif_pub_decode(pub, data.data(), data.size());
+}
+
+bool wif_pub_decode(ec_pubkey_t& pub, const char* data, std::size_t size) {
 
 	internal::pub_decoder_t decoder = internal::pub_decoder_legacy;
 	int offset;
-	std::vector<unsigned char> buf;
+	unsigned char buf[EC_PUBKEY_SIZE + CHECKSUM_SIZE];
+	std::size_t len = sizeof(buf);
 
 	// Check prefix
-	if (data.substr(0, WIF_PUB_K1.size()) == WIF_PUB_K1) {
+	if (_has_prefix(data, size, WIF_PUB_K1)) {
 		decoder = internal::pub_decoder_k1;
 		offset =  WIF_PUB_K1.size();
 	} else {
@@ -112,15 +219,15 @@ bool wif_pub_decode(ec_pubkey_t& pub, const std::string& data) {
 		offset = 3;
 	}
 
-	if (!base58_decode(data.c_str() + offset, buf)) {
+	if (!_decode(data, size, offset, buf, len)) {
 		return false;
 	}
 
-	if (buf.size() != EC_PUBKEY_SIZE + CHECKSUM_SIZE) {
+	if (len != EC_PUBKEY_SIZE + CHECKSUM_SIZE) {
 		return false;
 	}
 
-	return decoder(buf, pub);
+	return decoder(buf, len, pub);
 }
 
 void wif_print_key(const struct ec_keypair *key, const wif_codec_t& codec) {
@@ -130,20 +237,24 @@ void wif_print_key(const struct ec_keypair *key, const wif_codec_t& codec) {
 }
 
 bool wif_sig_decode(ec_signature_t& sig, const std::string& data) {
+	return wif_sig_decode(sig, data.data(), data.size());
+}
 
-	checksum_t checksum;
-	std::vector<unsigned char> buf;
+bool wif_sig_decode(ec_signature_t& sig, const char* data, std::size_t size) {
+
+	unsigned char buf[EC_SIGNATURE_SIZE + CHECKSUM_SIZE];
+	std::size_t len = sizeof(buf);
 
-	if (data.substr(0, WIF_SIG_K1.length()) != WIF_SIG_K1) {
+	if (!_has_prefix(data, size, WIF_SIG_K1)) {
 		// Invalid prefix
 		return false;
 	}
 
-	if (!base58_decode(data.c_str() + WIF_SIG_K1.length(), buf)) {
+	if (!_decode(data, size, WIF_SIG_K1.length(), buf, len)) {
 		return false;
 	}
 
-	return internal::sig_decoder_k1(buf, sig);
+	return internal::sig_decoder_k1(buf, len, sig);
 }
 
 std::string wif_sig_encode(const ec_signature_t& sig) {
@@ -151,7 +262,7 @@ std::string wif_sig_encode(const ec_signature_t& sig) {
 	unsigned char buf[EC_SIGNATURE_SIZE + CHECKSUM_SIZE];
 	internal::sig_encoder_k1(sig, buf);
 
-	return WIF_SIG_K1 + base58_encode(buf, buf + sizeof(buf));
+	return _encode<sizeof(buf)>(WIF_SIG_K1, buf);
 }
 
 } // namespace libeosio
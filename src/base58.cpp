@@ -29,11 +29,15 @@
 #include <cassert>
 #include <cstring>
 #include <libeosio/base58.hpp>
+#include "base58/fixed.hpp"
+#include "base58/classify.hpp"
 
 namespace libeosio {
 
-static const char charmap[59] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
-static const int8_t table[256] = {
+namespace internal {
+
+const char base58_charmap[59] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+const int8_t base58_table[256] = {
 	-1,-1,-1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
 	-1,-1,-1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
 	-1,-1,-1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
@@ -56,138 +60,270 @@ bool is_space(char c) {
 	return c == ' ' || c == '\f' || c == '\n' || c == '\r' || c == '\t' || c == '\v';
 }
 
+} // namespace internal
+
+using internal::is_space;
+
+static const char (&charmap)[59] = internal::base58_charmap;
+static const int8_t (&table)[256] = internal::base58_table;
+
+// Encode `len` bytes with the fixed width engine into `buf`.
+// returns the number of characters or zero if there is no engine instantiated for that length.
+static std::size_t _encode_fixed(const unsigned char* data, std::size_t len, char *buf) {
+
+	switch (len) {
+	// K1 private key + checksum.
+	case 32 + 4 : return internal::base58_fixed<32 + 4>::encode(data, buf);
+	// Public key + checksum or legacy private key + checksum.
+	case 33 + 4 : return internal::base58_fixed<33 + 4>::encode(data, buf);
+	// Signature + checksum.
+	case 65 + 4 : return internal::base58_fixed<65 + 4>::encode(data, buf);
+	}
+	return 0;
+}
+
+// Decode `len` characters with the fixed width engine if there is one instantiated for
+// the capacity `cap`. returns -1 if there is no engine for that capacity, otherwise
+// 1 on success and 0 on failure.
+static int _decode_fixed(const char *str, std::size_t len, unsigned char *out, std::size_t cap, std::size_t& outlen) {
+
+	switch (cap) {
+	// K1 private key + checksum.
+	case 32 + 4 : return internal::base58_fixed<32 + 4>::decode(str, len, out, outlen);
+	// Public key + checksum or legacy private key + checksum.
+	case 33 + 4 : return internal::base58_fixed<33 + 4>::decode(str, len, out, outlen);
+	// Signature + checksum.
+	case 65 + 4 : return internal::base58_fixed<65 + 4>::decode(str, len, out, outlen);
+	}
+	return -1;
+}
+
+bool base58_encode(const unsigned char *data, std::size_t len, char *out, std::size_t& outlen) {
+
+	std::size_t cap = outlen;
+	std::size_t zeroes = 0, length = 0, size;
+	char fixed[internal::base58_fixed<69>::max_size];
+
+	// Key and signature payloads has their own engine.
+	if ((size = _encode_fixed(data, len, fixed)) > 0) {
+		if (size > cap) {
+			outlen = base58_encoded_size(len);
+			return false;
+		}
+		std::memcpy(out, fixed, size);
+		outlen = size;
+		return true;
+	}
+
+	// Skip & count leading zeroes.
+	while (zeroes < len && data[zeroes] == 0) {
+		zeroes++;
+	}
+
+	if (zeroes > cap) {
+		outlen = base58_encoded_size(len);
+		return false;
+	}
+
+	// The part of `out` after the leading '1's is used as big-endian base58 scratch space.
+	unsigned char *b58 = (unsigned char *) out + zeroes;
+	size = cap - zeroes;
+
+	// Process the bytes.
+	for (std::size_t n = zeroes; n < len; n++) {
+		int carry = data[n];
+		std::size_t i = 0;
+		// Apply "b58 = b58 * 256 + ch".
+		for (unsigned char *it = b58 + size; (carry != 0 || i < length) && it != b58; i++) {
+			--it;
+			carry += 256 * (i < length ? *it : 0);
+			*it = static_cast<unsigned char>(carry % 58);
+			carry /= 58;
+		}
+
+		// Did not fit.
+		if (carry != 0) {
+			outlen = base58_encoded_size(len);
+			return false;
+		}
+		length = i;
+	}
+
+	// Skip leading zeroes in base58 result.
+	unsigned char *it = b58 + (size - length);
+	while (it != b58 + size && *it == 0) {
+		it++;
+	}
+
+	// Translate the result into characters.
+	length = (b58 + size) - it;
+	std::memset(out, '1', zeroes);
+	for (std::size_t i = 0; i < length; i++) {
+		out[zeroes + i] = charmap[it[i]];
+	}
+	outlen = zeroes + length;
+	return true;
+}
 
 std::string base58_encode(const unsigned char* pbegin, const unsigned char* pend) {
 
-    // Skip & count leading zeroes.
-    int zeroes = 0;
-    int length = 0;
-    while (pbegin != pend && *pbegin == 0) {
-        pbegin++;
-        zeroes++;
-    }
-    // Allocate enough space in big-endian base58 representation.
-    std::size_t size = (pend - pbegin) * 138 / 100 + 1; // log(256) / log(58), rounded up.
-    std::vector<unsigned char> b58(size);
-    // Process the bytes.
-    while (pbegin != pend) {
-        int carry = *pbegin;
-        int i = 0;
-        // Apply "b58 = b58 * 256 + ch".
-        for (std::vector<unsigned char>::reverse_iterator it = b58.rbegin(); (carry != 0 || i < length) && (it != b58.rend()); it++, i++) {
-            carry += 256 * (*it);
-            *it = static_cast<unsigned char>(carry % 58);
-            carry /= 58;
-        }
-
-        assert(carry == 0);
-        length = i;
-        pbegin++;
-    }
-    // Skip leading zeroes in base58 result.
-    std::vector<unsigned char>::iterator it = b58.begin() + (size - length);
-    while (it != b58.end() && *it == 0)
-        it++;
-    // Translate the result into a string.
-    std::string str;
-    str.reserve(zeroes + (b58.end() - it));
-    str.assign(zeroes, '1');
-    while (it != b58.end())
-        str += charmap[*(it++)];
-    return str;
+	std::string str;
+	std::size_t len = base58_encoded_size(pend - pbegin);
+
+	str.resize(len);
+	if (len == 0 || !base58_encode(pbegin, pend - pbegin, &str[0], len)) {
+		return std::string();
+	}
+	str.resize(len);
+	return str;
 }
 
 std::string base58_encode(const std::string& str) {
 
-    const unsigned char *ptr = (const unsigned char *) str.c_str();
-    return base58_encode(ptr, ptr + str.length());
+	const unsigned char *ptr = (const unsigned char *) str.c_str();
+	return base58_encode(ptr, ptr + str.length());
 }
 
 std::string base58_encode(const std::vector<unsigned char>& vch) {
 
-    return base58_encode(vch.data(), vch.data() + vch.size());
+	return base58_encode(vch.data(), vch.data() + vch.size());
 }
 
-bool base58_decode(const char* psz, std::vector<unsigned char>& out) {
-	// Skip leading spaces.
-	while (*psz && is_space(*psz))
-		psz++;
-	// Skip and count leading '1's.
-	int zeroes = 0;
-	int length = 0;
-	while (*psz == '1') {
+// Size of the buffer needed to decode `len` characters, each leading '1' is a byte of its own.
+static std::size_t _decoded_size(const char *str, std::size_t len) {
+
+	std::size_t zeroes = 0;
+
+	while (zeroes < len && str[zeroes] == '1') {
 		zeroes++;
-		psz++;
 	}
-	// Allocate enough space in big-endian base256 representation.
-	int size = strlen(psz) * 733 /1000 + 1; // log(58) / log(256), rounded up.
-	std::vector<unsigned char> b256(size);
-	// Process the characters.
+	return zeroes + base58_decoded_size(len - zeroes);
+}
+
+// The result of `len` characters did not fit. If they are valid base58 `outlen` is set
+// to the size needed, otherwise it is not changed. Returns false.
+static bool _too_small(const char *str, std::size_t len, std::size_t& outlen) {
+
+	if (internal::base58_find_invalid(str, len) == len) {
+		outlen = _decoded_size(str, len);
+	}
+	return false;
+}
+
+bool base58_decode(const char *str, std::size_t len, unsigned char *out, std::size_t& outlen) {
+
+	std::size_t cap = outlen;
+	std::size_t zeroes = 0, length = 0, size;
+
+	// Skip leading and trailing spaces.
+	internal::base58_trim(str, len);
+
+	// Key and signature payloads has their own engine.
+	int rc = _decode_fixed(str, len, out, cap, outlen);
+	if (rc >= 0) {
+		return rc == 1 || _too_small(str, len, outlen);
+	}
+
+	// Skip and count leading '1's (no need to count past the capacity).
+	while (zeroes < len && zeroes <= cap && str[zeroes] == '1') {
+		zeroes++;
+	}
+
+	// Reject input that can not fit in `cap` bytes before running the quadratic loop below.
+	// Every character after the leading '1's is a significant digit, and a number of
+	// `cap - zeroes` bytes has atmost base58_encoded_size(cap - zeroes) digits.
+	if (zeroes > cap || len - zeroes > base58_encoded_size(cap - zeroes)) {
+		return _too_small(str, len, outlen);
+	}
 
-	while (*psz && !is_space(*psz)) {
+	// The part of `out` after the leading zeroes is used as big-endian base256 scratch space.
+	unsigned char *b256 = out + zeroes;
+	size = cap - zeroes;
+
+	// Process the characters.
+	for (std::size_t n = zeroes; n < len; n++) {
 		// Decode base58 character
-		int carry = table[(uint8_t)*psz];
-		if (carry == -1)  // Invalid b58 character
+		int carry = table[(uint8_t) str[n]];
+		if (carry == -1) { // Invalid b58 character
 			return false;
-		int i = 0;
-		for (std::vector<unsigned char>::reverse_iterator it = b256.rbegin(); (carry != 0 || i < length) && (it != b256.rend()); ++it, ++i) {
-			carry += 58 * (*it);
+		}
+		std::size_t i = 0;
+		// Apply "b256 = b256 * 58 + ch".
+		for (unsigned char *it = b256 + size; (carry != 0 || i < length) && it != b256; i++) {
+			--it;
+			carry += 58 * (i < length ? *it : 0);
 			*it = carry % 256;
 			carry /= 256;
 		}
-		assert(carry == 0);
+
+		// Did not fit.
+		if (carry != 0) {
+			return _too_small(str, len, outlen);
+		}
 		length = i;
-		psz++;
 	}
 
-	// Skip trailing spaces.
-	while (is_space(*psz))
-		psz++;
-
-	if (*psz != 0)
-		return false;
-
 	// Skip leading zeroes in b256.
-	std::vector<unsigned char>::iterator it = b256.begin() + (size - length);
-	while (it != b256.end() && *it == 0)
+	unsigned char *it = b256 + (size - length);
+	while (it != b256 + size && *it == 0) {
 		it++;
+	}
 
-	// Copy result into output vector.
-	out.reserve(zeroes + (b256.end() - it));
-	out.assign(zeroes, 0);
-	while (it != b256.end())
-		out.push_back(*(it++));
+	// Move result next to the leading zeroes.
+	length = (b256 + size) - it;
+	std::memset(out, 0, zeroes);
+	std::memmove(b256, it, length);
+	outlen = zeroes + length;
 	return true;
 }
 
-bool base58_decode(const std::string& str, std::vector<unsigned char>& out) {
-	return base58_decode(str.c_str(), out);
+bool base58_decode(const char *str, std::size_t len, std::vector<unsigned char>& out, std::size_t max) {
+
+	std::size_t size;
+
+	internal::base58_trim(str, len);
+	size = _decoded_size(str, len);
+
+	if (size > max) {
+		size = max;
+	}
+
+	out.resize(size);
+	if (!base58_decode(str, len, out.data(), size)) {
+		out.clear();
+		return false;
+	}
+	out.resize(size);
+	return true;
+}
+
+bool base58_decode(const char* psz, std::vector<unsigned char>& out) {
+	return base58_decode(psz, std::strlen(psz), out, BASE58_DECODE_UNBOUNDED);
+}
+
+bool base58_decode(const std::string& str, std::vector<unsigned char>& out, std::size_t max) {
+	return base58_decode(str.data(), str.size(), out, max);
 }
 
 bool is_base58(char ch) {
-	for(unsigned int i=0; i < sizeof(charmap); i++) {
-		if (ch == charmap[i]) {
-			return true;
-		}
-	}
-	return false;
+	return table[(uint8_t) ch] != -1;
 }
 
 size_t is_base58(const std::string& str) {
 
-	auto p = std::find_if_not(str.begin(), str.end(), static_cast<bool (*)(char)>(is_base58));
+	size_t p = internal::base58_find_invalid(str.data(), str.size());
 
-	if (p == str.end()) {
+	if (p == str.size()) {
 		return std::string::npos;
 	}
-	return p - str.begin();
+	return p;
 }
 
 std::string& base58_strip(std::string &str) {
-	str.erase(std::remove_if(str.begin(), str.end(), [] (std::string::value_type ch)
-		{ return is_base58(ch) == false; }
-	), str.end());
-    return str;
+	if (!str.empty()) {
+		str.resize(internal::base58_compact(&str[0], str.size()));
+	}
+	return str;
 }
 
 } // namespace libeosio
@@ -0,0 +1,154 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <libeosio/base58.hpp>
+#include "../cpu.hpp"
+#include "batch_kernel.hpp"
+
+namespace libeosio {
+
+namespace internal {
+
+void base58_encode_lanes_generic(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths) {
+
+	base58_lanes_u32 limb[BASE58_BATCH_MAX_LIMBS];
+	base58_lanes_u64 group[BASE58_BATCH_MAX_GROUPS];
+	base58_lanes_u32 rem[BASE58_BATCH_MAX_GROUPS];
+	base58_lanes_u8 digits[BASE58_BATCH_MAX_GROUPS * 5];
+	std::size_t i, j, k;
+
+	base58_lanes_load(plan, data, n, limb);
+
+	// group[j] = sum(limb[i] * table[i][j])
+	std::memset(group, 0, sizeof(group));
+	for (i = 0; i < plan.limbs; i++) {
+		for (j = 0; j <= plan.top[i]; j++) {
+			const uint64_t t = plan.table[i][j];
+			for (k = 0; k < BASE58_BATCH_LANES; k++) {
+				group[j][k] += (uint64_t) limb[i][k] * t;
+			}
+		}
+	}
+
+	base58_lanes_carry(plan, group, rem);
+
+	// Split each group into 5 base58 digits, most significant digit first.
+	for (j = 0; j < plan.groups; j++) {
+		base58_lanes_u8 *d = digits + (plan.groups - j) * 5 - 1;
+		uint32_t *v = rem[j];
+
+		for (i = 0; i < 5; i++, d--) {
+			for (k = 0; k < BASE58_BATCH_LANES; k++) {
+				(*d)[k] = v[k] % 58;
+				v[k] /= 58;
+			}
+		}
+	}
+
+	base58_lanes_store(plan, data, n, digits, out, stride, lengths);
+}
+
+static base58_batch_kernel_t _select() {
+#if defined(LIBEOSIO_SIMD_X86)
+	const cpu_features& cpu = cpu_get_features();
+
+	if (cpu.avx512bw) {
+		return base58_encode_lanes_avx512;
+	}
+	if (cpu.avx2) {
+		return base58_encode_lanes_avx2;
+	}
+#endif
+	return base58_encode_lanes_generic;
+}
+
+static base58_batch_kernel_t _kernel() {
+	static const base58_batch_kernel_t k = _select();
+	return k;
+}
+
+void base58_batch_prepare(base58_batch_plan& plan, std::size_t len) {
+
+	// Radix 58^5 digits of the current limb weight, least significant first.
+	uint64_t w[BASE58_BATCH_MAX_GROUPS] = { 1 };
+
+	plan.len = len;
+	plan.limbs = (len + 2) / 3;
+	plan.groups = (base58_encoded_size(len) + 4) / 5;
+
+	// Least significant limb has weight 1, every limb above it 2^24 times more.
+	for (std::size_t i = plan.limbs; i-- > 0; ) {
+		uint64_t carry = 0;
+
+		plan.top[i] = 0;
+		for (std::size_t j = 0; j < plan.groups; j++) {
+			plan.table[i][j] = (uint32_t) w[j];
+			if (w[j]) {
+				plan.top[i] = j;
+			}
+
+			// Next weight: w = w * 2^24
+			uint64_t cur = (w[j] << 24) + carry;
+			w[j] = cur % BASE58_BATCH_RADIX;
+			carry = cur / BASE58_BATCH_RADIX;
+		}
+	}
+}
+
+} // namespace internal
+
+bool base58_encode_batch(const unsigned char* data, std::size_t len, std::size_t count,
+	char* out, std::size_t stride, std::size_t* lengths) {
+
+	if (stride <= base58_encoded_size(len)) {
+		return false;
+	}
+
+	// Payloads that are to large for the batch engine are encoded one at a time.
+	if (len > BASE58_BATCH_MAX_SIZE) {
+		for (std::size_t k = 0; k < count; k++) {
+			std::size_t n = stride - 1;
+			base58_encode(data + k * len, len, out + k * stride, n);
+			out[k * stride + n] = '\0';
+			if (lengths) {
+				lengths[k] = n;
+			}
+		}
+		return true;
+	}
+
+	internal::base58_batch_plan plan;
+	internal::base58_batch_kernel_t kernel = internal::_kernel();
+
+	internal::base58_batch_prepare(plan, len);
+
+	for (std::size_t k = 0; k < count; k += BASE58_BATCH_LANES) {
+		std::size_t n = count - k < BASE58_BATCH_LANES ? count - k : BASE58_BATCH_LANES;
+		kernel(plan, data + k * len, n, out + k * stride, stride, lengths ? lengths + k : NULL);
+	}
+
+	return true;
+}
+
+} // namespace libeosio
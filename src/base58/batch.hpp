@@ -0,0 +1,96 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_BASE58_BATCH_H
+#define LIBEOSIO_BASE58_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Batch encoding
+ *
+ * Payloads are loaded as big-endian 24-bit limbs and converted to radix 58^5 with a
+ * table of the limb weights (2^(24 * k) written in radix 58^5):
+ *
+ *   group[j] = sum(limb[i] * table[i][j])
+ *
+ * followed by a single carry pass. Unlike the carry loops used elsewhere, the
+ * multiply-adds are independent of each other, so they are run for
+ * BASE58_BATCH_LANES payloads side by side, one payload per SIMD lane.
+ * Splitting the groups into base58 digits is done across lanes the same way.
+ *
+ * 24-bit limbs times table entries (< 58^5 < 2^30) summed over all limbs stays
+ * well below 2^64 for payloads up to BASE58_BATCH_MAX_SIZE bytes.
+ */
+#define BASE58_BATCH_LANES 16
+#define BASE58_BATCH_MAX_SIZE 128
+#define BASE58_BATCH_MAX_LIMBS ((BASE58_BATCH_MAX_SIZE + 2) / 3)
+#define BASE58_BATCH_MAX_GROUPS ((BASE58_BATCH_MAX_SIZE * 138 / 100 + 1 + 4) / 5)
+
+// 58^5
+#define BASE58_BATCH_RADIX 656356768ULL
+
+// v / 58 == (v * BASE58_BATCH_DIV58_MUL) >> BASE58_BATCH_DIV58_SHIFT for all v < 58^5.
+#define BASE58_BATCH_DIV58_MUL 592409283U
+#define BASE58_BATCH_DIV58_SHIFT 35
+
+/**
+ * Conversion table for a payload size.
+ */
+struct base58_batch_plan {
+	std::size_t len;
+	std::size_t limbs;
+	std::size_t groups;
+	// Index of the most significant non-zero group in each table row.
+	std::size_t top[BASE58_BATCH_MAX_LIMBS];
+	uint32_t table[BASE58_BATCH_MAX_LIMBS][BASE58_BATCH_MAX_GROUPS];
+};
+
+/**
+ * Build the conversion table for `len` (atmost BASE58_BATCH_MAX_SIZE) byte payloads.
+ */
+void base58_batch_prepare(base58_batch_plan& plan, std::size_t len);
+
+/**
+ * Encode `n` (atmost BASE58_BATCH_LANES) payloads of `plan.len` bytes.
+ * The result for payload `k` is written NUL terminated to `out + k * stride`
+ * and its length to `lengths[k]` (if `lengths` is not NULL).
+ */
+typedef void (*base58_batch_kernel_t)(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths);
+
+void base58_encode_lanes_generic(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths);
+
+void base58_encode_lanes_avx2(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths);
+
+void base58_encode_lanes_avx512(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths);
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_BASE58_BATCH_H */
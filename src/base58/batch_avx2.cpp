@@ -0,0 +1,118 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "batch_kernel.hpp"
+
+namespace libeosio { namespace internal {
+
+static_assert(BASE58_BATCH_LANES == 16, "kernel is written for 16 lanes");
+
+// Number of 64-bit and 32-bit vectors needed to cover all lanes.
+#define V64 (BASE58_BATCH_LANES / 4)
+#define V32 (BASE58_BATCH_LANES / 8)
+
+// Divides each 32-bit lane (< 58^5) by 58.
+static inline __m256i _div58(__m256i v, __m256i m) {
+	__m256i even = _mm256_srli_epi64(_mm256_mul_epu32(v, m), BASE58_BATCH_DIV58_SHIFT);
+	__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), m);
+	odd = _mm256_slli_epi64(_mm256_srli_epi64(odd, BASE58_BATCH_DIV58_SHIFT), 32);
+	return _mm256_blend_epi32(even, odd, 0xaa);
+}
+
+void base58_encode_lanes_avx2(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths) {
+
+	base58_lanes_u32 limb[BASE58_BATCH_MAX_LIMBS];
+	alignas(32) base58_lanes_u64 group[BASE58_BATCH_MAX_GROUPS];
+	alignas(32) base58_lanes_u32 rem[BASE58_BATCH_MAX_GROUPS];
+	base58_lanes_u8 digits[BASE58_BATCH_MAX_GROUPS * 5];
+	__m256i l[BASE58_BATCH_MAX_LIMBS][V64];
+	std::size_t i, j, q;
+
+	base58_lanes_load(plan, data, n, limb);
+
+	// Widen the limbs to 64-bit lanes, _mm256_mul_epu32 uses the low half.
+	for (i = 0; i < plan.limbs; i++) {
+		for (q = 0; q < V64; q++) {
+			l[i][q] = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *) &limb[i][q * 4]));
+		}
+	}
+
+	// group[j] = sum(limb[i] * table[i][j]), accumulated in registers.
+	for (j = 0; j < plan.groups; j++) {
+		__m256i acc[V64];
+
+		for (q = 0; q < V64; q++) {
+			acc[q] = _mm256_setzero_si256();
+		}
+
+		for (i = 0; i < plan.limbs; i++) {
+			if (j > plan.top[i]) {
+				continue;
+			}
+
+			const __m256i t = _mm256_set1_epi64x(plan.table[i][j]);
+			for (q = 0; q < V64; q++) {
+				acc[q] = _mm256_add_epi64(acc[q], _mm256_mul_epu32(l[i][q], t));
+			}
+		}
+
+		for (q = 0; q < V64; q++) {
+			_mm256_store_si256((__m256i *) &group[j][q * 4], acc[q]);
+		}
+	}
+
+	base58_lanes_carry(plan, group, rem);
+
+	// Split each group into 5 base58 digits, most significant digit first.
+	const __m256i m = _mm256_set1_epi32(BASE58_BATCH_DIV58_MUL);
+	const __m256i b = _mm256_set1_epi32(58);
+
+	for (j = 0; j < plan.groups; j++) {
+		base58_lanes_u8 *d = digits + (plan.groups - j) * 5 - 1;
+		__m256i v[V32], r[V32];
+
+		for (q = 0; q < V32; q++) {
+			v[q] = _mm256_load_si256((const __m256i *) &rem[j][q * 8]);
+		}
+
+		for (i = 0; i < 5; i++, d--) {
+			for (q = 0; q < V32; q++) {
+				__m256i t = _div58(v[q], m);
+				r[q] = _mm256_sub_epi32(v[q], _mm256_mullo_epi32(t, b));
+				v[q] = t;
+			}
+
+			// Narrow 2x8 32-bit lanes to 16 bytes, packus works per 128-bit half
+			// so the 64-bit blocks are put back in order in between.
+			__m256i w = _mm256_permute4x64_epi64(_mm256_packus_epi32(r[0], r[1]), 0xd8);
+			_mm_storeu_si128((__m128i *) *d, _mm_packus_epi16(
+				_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1)));
+		}
+	}
+
+	base58_lanes_store(plan, data, n, digits, out, stride, lengths);
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,106 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "batch_kernel.hpp"
+
+namespace libeosio { namespace internal {
+
+static_assert(BASE58_BATCH_LANES == 16, "kernel is written for 16 lanes");
+
+// Number of 64-bit vectors needed to cover all lanes.
+#define V64 (BASE58_BATCH_LANES / 8)
+
+// Divides each 32-bit lane (< 58^5) by 58.
+static inline __m512i _div58(__m512i v, __m512i m) {
+	__m512i even = _mm512_srli_epi64(_mm512_mul_epu32(v, m), BASE58_BATCH_DIV58_SHIFT);
+	__m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(v, 32), m);
+	odd = _mm512_slli_epi64(_mm512_srli_epi64(odd, BASE58_BATCH_DIV58_SHIFT), 32);
+	return _mm512_mask_blend_epi32(0xaaaa, even, odd);
+}
+
+void base58_encode_lanes_avx512(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, char *out, std::size_t stride, std::size_t *lengths) {
+
+	base58_lanes_u32 limb[BASE58_BATCH_MAX_LIMBS];
+	alignas(64) base58_lanes_u64 group[BASE58_BATCH_MAX_GROUPS];
+	alignas(64) base58_lanes_u32 rem[BASE58_BATCH_MAX_GROUPS];
+	base58_lanes_u8 digits[BASE58_BATCH_MAX_GROUPS * 5];
+	__m512i l[BASE58_BATCH_MAX_LIMBS][V64];
+	std::size_t i, j, q;
+
+	base58_lanes_load(plan, data, n, limb);
+
+	// Widen the limbs to 64-bit lanes, _mm512_mul_epu32 uses the low half.
+	for (i = 0; i < plan.limbs; i++) {
+		for (q = 0; q < V64; q++) {
+			l[i][q] = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *) &limb[i][q * 8]));
+		}
+	}
+
+	// group[j] = sum(limb[i] * table[i][j]), accumulated in registers.
+	for (j = 0; j < plan.groups; j++) {
+		__m512i acc[V64];
+
+		for (q = 0; q < V64; q++) {
+			acc[q] = _mm512_setzero_si512();
+		}
+
+		for (i = 0; i < plan.limbs; i++) {
+			if (j > plan.top[i]) {
+				continue;
+			}
+
+			const __m512i t = _mm512_set1_epi64(plan.table[i][j]);
+			for (q = 0; q < V64; q++) {
+				acc[q] = _mm512_add_epi64(acc[q], _mm512_mul_epu32(l[i][q], t));
+			}
+		}
+
+		for (q = 0; q < V64; q++) {
+			_mm512_store_si512((__m512i *) &group[j][q * 8], acc[q]);
+		}
+	}
+
+	base58_lanes_carry(plan, group, rem);
+
+	// Split each group into 5 base58 digits, most significant digit first.
+	const __m512i m = _mm512_set1_epi32(BASE58_BATCH_DIV58_MUL);
+	const __m512i b = _mm512_set1_epi32(58);
+
+	for (j = 0; j < plan.groups; j++) {
+		base58_lanes_u8 *d = digits + (plan.groups - j) * 5 - 1;
+		__m512i v = _mm512_load_si512((const __m512i *) rem[j]);
+
+		for (i = 0; i < 5; i++, d--) {
+			__m512i t = _div58(v, m);
+			__m512i r = _mm512_sub_epi32(v, _mm512_mullo_epi32(t, b));
+			_mm_storeu_si128((__m128i *) *d, _mm512_cvtepi32_epi8(r));
+			v = t;
+		}
+	}
+
+	base58_lanes_store(plan, data, n, digits, out, stride, lengths);
+}
+
+}} // namespace libeosio::internal
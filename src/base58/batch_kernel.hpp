@@ -0,0 +1,121 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_BASE58_BATCH_KERNEL_H
+#define LIBEOSIO_BASE58_BATCH_KERNEL_H
+
+#include <cstring>
+#include "fixed.hpp"
+#include "batch.hpp"
+
+// This file is included by every batch kernel source file, each compiled with
+// different instruction set flags. The helpers have internal linkage so the linker
+// never merges the copies.
+namespace libeosio { namespace internal { namespace {
+
+typedef uint32_t base58_lanes_u32[BASE58_BATCH_LANES];
+typedef uint64_t base58_lanes_u64[BASE58_BATCH_LANES];
+typedef unsigned char base58_lanes_u8[BASE58_BATCH_LANES];
+
+// Load limbs, one payload per lane. Unused lanes are zero.
+// The most significant limb is padded with zero bytes.
+inline void base58_lanes_load(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, base58_lanes_u32 *limb) {
+
+	const std::size_t len = plan.len, limbs = plan.limbs;
+	const std::size_t pad = limbs * 3 - len;
+	std::size_t i, k;
+
+	std::memset(limb, 0, sizeof(base58_lanes_u32) * BASE58_BATCH_MAX_LIMBS);
+	for (k = 0; k < n; k++) {
+		const unsigned char *p = data + k * len;
+
+		if (limbs) {
+			uint32_t l = 0;
+			for (i = 0; i < 3 - pad; i++) {
+				l = (l << 8) | *p++;
+			}
+			limb[0][k] = l;
+		}
+
+		for (i = 1; i < limbs; i++, p += 3) {
+			limb[i][k] = ((uint32_t) p[0] << 16) | ((uint32_t) p[1] << 8) | p[2];
+		}
+	}
+}
+
+// Carry pass, least significant group first.
+// Writes the final (< 58^5) value of each group to `rem`.
+inline void base58_lanes_carry(const base58_batch_plan& plan, base58_lanes_u64 *group,
+	base58_lanes_u32 *rem) {
+
+	std::size_t j, k;
+
+	for (j = 0; j + 1 < plan.groups; j++) {
+		for (k = 0; k < BASE58_BATCH_LANES; k++) {
+			group[j + 1][k] += group[j][k] / BASE58_BATCH_RADIX;
+			rem[j][k] = (uint32_t) (group[j][k] % BASE58_BATCH_RADIX);
+		}
+	}
+
+	for (k = 0; k < BASE58_BATCH_LANES && plan.groups; k++) {
+		rem[j][k] = (uint32_t) group[j][k];
+	}
+}
+
+// Translate each lane into characters.
+inline void base58_lanes_store(const base58_batch_plan& plan, const unsigned char *data,
+	std::size_t n, const base58_lanes_u8 *digits, char *out, std::size_t stride,
+	std::size_t *lengths) {
+
+	const std::size_t len = plan.len, ndigits = plan.groups * 5;
+	std::size_t i, k;
+
+	for (k = 0; k < n; k++) {
+		const unsigned char *p = data + k * len;
+		std::size_t zeroes = 0, pos;
+		char *str = out + k * stride;
+
+		// Leading zero bytes are encoded as '1'
+		while (zeroes < len && p[zeroes] == 0) {
+			zeroes++;
+		}
+
+		for (i = 0; i < ndigits && digits[i][k] == 0; i++);
+
+		std::memset(str, '1', zeroes);
+		pos = zeroes;
+		for (; i < ndigits; i++) {
+			str[pos++] = base58_charmap[digits[i][k]];
+		}
+		str[pos] = '\0';
+
+		if (lengths) {
+			lengths[k] = pos;
+		}
+	}
+}
+
+}}} // namespace libeosio::internal::(anonymous)
+
+#endif /* LIBEOSIO_BASE58_BATCH_KERNEL_H */
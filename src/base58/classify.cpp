@@ -0,0 +1,80 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include "../cpu.hpp"
+#include "classify.hpp"
+
+namespace libeosio { namespace internal {
+
+std::size_t base58_find_invalid_scalar(const char *str, std::size_t len) {
+	std::size_t i;
+	for (i = 0; i < len && base58_table[(uint8_t) str[i]] != -1; i++);
+	return i;
+}
+
+std::size_t base58_compact_scalar(char *str, std::size_t len) {
+	return base58_compact_tail(str, 0, 0, len);
+}
+
+typedef std::size_t (*find_invalid_fn)(const char *, std::size_t);
+typedef std::size_t (*compact_fn)(char *, std::size_t);
+
+struct classify_kernel {
+	find_invalid_fn find_invalid;
+	compact_fn compact;
+};
+
+static classify_kernel _select() {
+	classify_kernel k = { base58_find_invalid_scalar, base58_compact_scalar };
+#if defined(LIBEOSIO_SIMD_X86)
+	const cpu_features& cpu = cpu_get_features();
+
+	if (cpu.avx512bw) {
+		k.find_invalid = base58_find_invalid_avx512;
+		k.compact = base58_compact_avx512;
+	} else if (cpu.avx2) {
+		k.find_invalid = base58_find_invalid_avx2;
+		k.compact = base58_compact_avx2;
+	} else if (cpu.sse41) {
+		k.find_invalid = base58_find_invalid_sse41;
+		k.compact = base58_compact_sse41;
+	}
+#endif
+	return k;
+}
+
+static const classify_kernel& _kernel() {
+	static const classify_kernel k = _select();
+	return k;
+}
+
+std::size_t base58_find_invalid(const char *str, std::size_t len) {
+	return _kernel().find_invalid(str, len);
+}
+
+std::size_t base58_compact(char *str, std::size_t len) {
+	return _kernel().compact(str, len);
+}
+
+}} // namespace libeosio::internal
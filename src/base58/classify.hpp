@@ -0,0 +1,105 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_BASE58_CLASSIFY_H
+#define LIBEOSIO_BASE58_CLASSIFY_H
+
+#include <cstddef>
+#include <cstdint>
+#include "fixed.hpp"
+
+namespace libeosio { namespace internal {
+
+/**
+ * Returns the position of the first non-base58 character in `str`, or `len` if all are valid.
+ */
+std::size_t base58_find_invalid(const char *str, std::size_t len);
+
+/**
+ * Moves all base58 characters in `str` to the front (keeping their order).
+ * Returns the number of base58 characters.
+ */
+std::size_t base58_compact(char *str, std::size_t len);
+
+/**
+ * Kernels, selected at runtime by base58_find_invalid() and base58_compact().
+ *
+ * The SIMD kernels classify a whole register of characters at a time with two 16 entry
+ * nibble lookup tables: a character is valid if lut_lo[c & 0xf] & lut_hi[c >> 4] != 0.
+ * Any remaining tail is handled by the scalar kernel.
+ */
+std::size_t base58_find_invalid_scalar(const char *str, std::size_t len);
+std::size_t base58_compact_scalar(char *str, std::size_t len);
+
+std::size_t base58_find_invalid_sse41(const char *str, std::size_t len);
+std::size_t base58_compact_sse41(char *str, std::size_t len);
+
+std::size_t base58_find_invalid_avx2(const char *str, std::size_t len);
+std::size_t base58_compact_avx2(char *str, std::size_t len);
+
+std::size_t base58_find_invalid_avx512(const char *str, std::size_t len);
+std::size_t base58_compact_avx512(char *str, std::size_t len);
+
+// Lookup tables (indexed by low and high nibble)
+#define BASE58_LUT_LO 4, 15, 15, 15, 15, 15, 15, 15, 15, 13, 14, 10, 2, 10, 10, 8
+#define BASE58_LUT_HI 0, 0, 0, 1, 2, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0
+
+// Copies the characters in `src` that has their bit set in `valid` to `dst`.
+// Returns the number of characters copied.
+inline std::size_t base58_compact_mask(char *dst, const char *src, uint64_t valid) {
+	std::size_t n = 0;
+	for (unsigned i = 0; valid; i++, valid >>= 1) {
+		if (valid & 1) {
+			dst[n++] = src[i];
+		}
+	}
+	return n;
+}
+
+// Compacts the characters from position `i` to `len` to position `n` and returns the new length.
+inline std::size_t base58_compact_tail(char *str, std::size_t n, std::size_t i, std::size_t len) {
+	for (; i < len; i++) {
+		if (base58_table[(uint8_t) str[i]] != -1) {
+			str[n++] = str[i];
+		}
+	}
+	return n;
+}
+
+// Index of the lowest set bit, `v` must be non-zero.
+inline unsigned base58_ctz(uint64_t v) {
+#if defined(__GNUC__)
+	return __builtin_ctzll(v);
+#else
+	unsigned n = 0;
+	while (!(v & 1)) {
+		v >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_BASE58_CLASSIFY_H */
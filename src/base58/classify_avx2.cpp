@@ -0,0 +1,72 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "classify.hpp"
+
+namespace libeosio { namespace internal {
+
+// Returns a 32 bit mask with a bit set for every base58 character in `c`
+static inline uint32_t _valid_mask(__m256i c) {
+	// vpshufb looks up within each 128 bit lane, so the tables are repeated.
+	const __m256i lut_lo = _mm256_setr_epi8(BASE58_LUT_LO, BASE58_LUT_LO);
+	const __m256i lut_hi = _mm256_setr_epi8(BASE58_LUT_HI, BASE58_LUT_HI);
+	const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+	__m256i lo = _mm256_and_si256(c, nibble);
+	__m256i hi = _mm256_and_si256(_mm256_srli_epi16(c, 4), nibble);
+	__m256i m = _mm256_and_si256(_mm256_shuffle_epi8(lut_lo, lo), _mm256_shuffle_epi8(lut_hi, hi));
+
+	return ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(m, _mm256_setzero_si256()));
+}
+
+std::size_t base58_find_invalid_avx2(const char *str, std::size_t len) {
+	std::size_t i = 0;
+
+	for (; i + 32 <= len; i += 32) {
+		uint32_t valid = _valid_mask(_mm256_loadu_si256((const __m256i *) (str + i)));
+		if (valid != 0xffffffff) {
+			return i + base58_ctz(~valid);
+		}
+	}
+	return i + base58_find_invalid_scalar(str + i, len - i);
+}
+
+std::size_t base58_compact_avx2(char *str, std::size_t len) {
+	std::size_t i = 0, n = 0;
+
+	for (; i + 32 <= len; i += 32) {
+		__m256i c = _mm256_loadu_si256((const __m256i *) (str + i));
+		uint32_t valid = _valid_mask(c);
+
+		if (valid == 0xffffffff) {
+			_mm256_storeu_si256((__m256i *) (str + n), c);
+			n += 32;
+		} else {
+			n += base58_compact_mask(str + n, str + i, valid);
+		}
+	}
+	return base58_compact_tail(str, n, i, len);
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,72 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "classify.hpp"
+
+namespace libeosio { namespace internal {
+
+// Returns a 64 bit mask with a bit set for every base58 character in `c`
+static inline uint64_t _valid_mask(__m512i c) {
+	// vpshufb looks up within each 128 bit lane, so the tables are repeated.
+	const __m512i lut_lo = _mm512_broadcast_i32x4(_mm_setr_epi8(BASE58_LUT_LO));
+	const __m512i lut_hi = _mm512_broadcast_i32x4(_mm_setr_epi8(BASE58_LUT_HI));
+	const __m512i nibble = _mm512_set1_epi8(0x0f);
+
+	__m512i lo = _mm512_and_si512(c, nibble);
+	__m512i hi = _mm512_and_si512(_mm512_srli_epi16(c, 4), nibble);
+	__m512i m = _mm512_and_si512(_mm512_shuffle_epi8(lut_lo, lo), _mm512_shuffle_epi8(lut_hi, hi));
+
+	return _mm512_test_epi8_mask(m, m);
+}
+
+std::size_t base58_find_invalid_avx512(const char *str, std::size_t len) {
+	std::size_t i = 0;
+
+	for (; i + 64 <= len; i += 64) {
+		uint64_t valid = _valid_mask(_mm512_loadu_si512((const void *) (str + i)));
+		if (valid != 0xffffffffffffffffULL) {
+			return i + base58_ctz(~valid);
+		}
+	}
+	return i + base58_find_invalid_scalar(str + i, len - i);
+}
+
+std::size_t base58_compact_avx512(char *str, std::size_t len) {
+	std::size_t i = 0, n = 0;
+
+	for (; i + 64 <= len; i += 64) {
+		__m512i c = _mm512_loadu_si512((const void *) (str + i));
+		uint64_t valid = _valid_mask(c);
+
+		if (valid == 0xffffffffffffffffULL) {
+			_mm512_storeu_si512((void *) (str + n), c);
+			n += 64;
+		} else {
+			n += base58_compact_mask(str + n, str + i, valid);
+		}
+	}
+	return base58_compact_tail(str, n, i, len);
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,71 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <smmintrin.h>
+#include "classify.hpp"
+
+namespace libeosio { namespace internal {
+
+// Returns a 16 bit mask with a bit set for every base58 character in `c`
+static inline uint32_t _valid_mask(__m128i c) {
+	const __m128i lut_lo = _mm_setr_epi8(BASE58_LUT_LO);
+	const __m128i lut_hi = _mm_setr_epi8(BASE58_LUT_HI);
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+
+	__m128i lo = _mm_and_si128(c, nibble);
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(c, 4), nibble);
+	__m128i m = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo), _mm_shuffle_epi8(lut_hi, hi));
+
+	return ~_mm_movemask_epi8(_mm_cmpeq_epi8(m, _mm_setzero_si128())) & 0xffff;
+}
+
+std::size_t base58_find_invalid_sse41(const char *str, std::size_t len) {
+	std::size_t i = 0;
+
+	for (; i + 16 <= len; i += 16) {
+		uint32_t valid = _valid_mask(_mm_loadu_si128((const __m128i *) (str + i)));
+		if (valid != 0xffff) {
+			return i + base58_ctz(~valid);
+		}
+	}
+	return i + base58_find_invalid_scalar(str + i, len - i);
+}
+
+std::size_t base58_compact_sse41(char *str, std::size_t len) {
+	std::size_t i = 0, n = 0;
+
+	for (; i + 16 <= len; i += 16) {
+		__m128i c = _mm_loadu_si128((const __m128i *) (str + i));
+		uint32_t valid = _valid_mask(c);
+
+		if (valid == 0xffff) {
+			_mm_storeu_si128((__m128i *) (str + n), c);
+			n += 16;
+		} else {
+			n += base58_compact_mask(str + n, str + i, valid);
+		}
+	}
+	return base58_compact_tail(str, n, i, len);
+}
+
+}} // namespace libeosio::internal
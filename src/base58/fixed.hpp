@@ -0,0 +1,215 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_BASE58_FIXED_H
+#define LIBEOSIO_BASE58_FIXED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Base58 alphabet and reverse lookup table (defined in src/base58.cpp)
+ */
+extern const char base58_charmap[59];
+extern const int8_t base58_table[256];
+
+bool is_space(char c);
+
+/**
+ * Fixed width base58 engine.
+ *
+ * Instead of the byte-at-a-time carry loop used by the generic functions,
+ * the payload is kept as big-endian 32-bit limbs that are divided (encode)
+ * or multiplied (decode) by 58^5 at a time, so five base58 digits are
+ * produced/consumed per pass using only 64-bit arithmetic.
+ *
+ * All buffers are sized from `N` at compile time, so nothing is allocated.
+ */
+template <std::size_t N>
+struct base58_fixed {
+
+	// 58^5, the largest power of 58 that fits in 32 bits.
+	static const uint32_t radix = 656356768UL;
+
+	// Number of 32-bit limbs needed to hold N bytes.
+	static const std::size_t limbs = (N + 3) / 4;
+
+	// Maximum number of base58 digits for N bytes. log(256) / log(58), rounded up.
+	static const std::size_t max_size = N * 138 / 100 + 1;
+
+	// Number of radix 58^5 groups needed to hold max_size digits.
+	static const std::size_t groups = (max_size + 4) / 5;
+
+	/**
+	 * Encode exactly `N` bytes from `in` into `out`.
+	 * `out` must have room for atleast `max_size` characters (no NUL terminator is written).
+	 * Returns the number of characters written.
+	 */
+	static std::size_t encode(const unsigned char *in, char *out) {
+
+		uint32_t num[limbs];
+		unsigned char digits[groups * 5];
+		std::size_t zeroes = 0, start, i, j, len = 0;
+
+		// Count leading zeroes.
+		while (zeroes < N && in[zeroes] == 0) {
+			zeroes++;
+		}
+
+		// Load big-endian limbs, first limb is padded with zeroes if N is not a multiple of 4.
+		std::memset(num, 0, sizeof(num));
+		for (i = 0; i < N; i++) {
+			std::size_t pos = i + (limbs * 4 - N);
+			num[pos / 4] |= (uint32_t) in[i] << (8 * (3 - (pos % 4)));
+		}
+
+		// Repeatedly divide by 58^5, each remainder is the next 5 (least significant) digits.
+		start = zeroes / 4;
+		for (i = 0; i < groups; i++) {
+			uint64_t rem = 0;
+
+			for (j = start; j < limbs; j++) {
+				uint64_t cur = (rem << 32) | num[j];
+				num[j] = (uint32_t) (cur / radix);
+				rem = cur % radix;
+			}
+
+			// Skip limbs that has become zero.
+			while (start < limbs && num[start] == 0) {
+				start++;
+			}
+
+			for (j = 0; j < 5; j++) {
+				digits[(groups - i) * 5 - 1 - j] = (unsigned char) (rem % 58);
+				rem /= 58;
+			}
+		}
+
+		// Skip leading zero digits.
+		for (i = 0; i < groups * 5 && digits[i] == 0; i++);
+
+		// Leading zero bytes are encoded as '1'
+		std::memset(out, '1', zeroes);
+		len = zeroes;
+		for (; i < groups * 5; i++) {
+			out[len++] = base58_charmap[digits[i]];
+		}
+		return len;
+	}
+
+	/**
+	 * Decode `len` base58 characters from `in` into `out`. No whitespace is allowed.
+	 * `out` must have room for atleast `N` bytes.
+	 *
+	 * On success, the number of decoded bytes is stored in `outlen` and true is returned.
+	 * False is returned if the input is not valid base58 or if the decoded value does
+	 * not fit in `N` bytes.
+	 */
+	static bool decode(const char *in, std::size_t len, unsigned char *out, std::size_t& outlen) {
+
+		uint32_t num[limbs];
+		unsigned char bytes[limbs * 4];
+		std::size_t zeroes = 0, i, k, m;
+
+		// Skip and count leading '1's (no need to count past N).
+		while (zeroes < len && zeroes <= N && in[zeroes] == '1') {
+			zeroes++;
+		}
+
+		// Reject input that can never fit before doing any work.
+		if (zeroes > N || len - zeroes > max_size) {
+			return false;
+		}
+
+		in += zeroes;
+		len -= zeroes;
+
+		std::memset(num, 0, sizeof(num));
+
+		// First chunk takes the remainder so that all others are full 5 digit groups.
+		k = len % 5 ? len % 5 : 5;
+		for (i = 0; i < len; i += k, k = 5) {
+			uint64_t mul = 1, carry = 0;
+
+			for (std::size_t j = 0; j < k; j++) {
+				int8_t v = base58_table[(uint8_t) in[i + j]];
+				if (v == -1) {
+					return false;
+				}
+				carry = carry * 58 + v;
+				mul *= 58;
+			}
+
+			// Apply "num = num * 58^k + carry"
+			for (std::size_t j = limbs; j-- > 0; ) {
+				uint64_t cur = (uint64_t) num[j] * mul + carry;
+				num[j] = (uint32_t) cur;
+				carry = cur >> 32;
+			}
+
+			if (carry) {
+				return false;
+			}
+		}
+
+		for (i = 0; i < limbs; i++) {
+			bytes[i * 4 + 0] = (unsigned char) (num[i] >> 24);
+			bytes[i * 4 + 1] = (unsigned char) (num[i] >> 16);
+			bytes[i * 4 + 2] = (unsigned char) (num[i] >> 8);
+			bytes[i * 4 + 3] = (unsigned char) num[i];
+		}
+
+		// Skip leading zero bytes of the number.
+		for (m = 0; m < limbs * 4 && bytes[m] == 0; m++);
+		m = limbs * 4 - m;
+
+		if (zeroes + m > N) {
+			return false;
+		}
+
+		std::memset(out, 0, zeroes);
+		std::memcpy(out + zeroes, bytes + (limbs * 4 - m), m);
+		outlen = zeroes + m;
+		return true;
+	}
+};
+
+/**
+ * Remove leading and trailing whitespace from a string given as pointer + length.
+ */
+inline void base58_trim(const char*& str, std::size_t& len) {
+	while (len && is_space(*str)) {
+		str++;
+		len--;
+	}
+	while (len && is_space(str[len - 1])) {
+		len--;
+	}
+}
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_BASE58_FIXED_H */
@@ -0,0 +1,137 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <libeosio/base58.hpp>
+#include "fixed.hpp"
+
+namespace libeosio {
+
+// Fixed width big-endian numbers, used to compute the range bounds.
+typedef std::vector<unsigned char> _bignum;
+
+// n = n * mul + add, returns false on overflow.
+static bool _mul_add(_bignum& n, unsigned int mul, unsigned int add) {
+
+	unsigned int carry = add;
+
+	for (std::size_t i = n.size(); i-- > 0; ) {
+		carry += n[i] * mul;
+		n[i] = carry & 0xff;
+		carry >>= 8;
+	}
+	return carry == 0;
+}
+
+// n = n - 1 (n must be greater than zero)
+static void _sub1(_bignum& n) {
+	for (std::size_t i = n.size(); i-- > 0 && n[i]-- == 0; );
+}
+
+// Returns true if the first `num` bytes of `n` are zero.
+static bool _zero_prefix(const _bignum& n, std::size_t num) {
+	for (std::size_t i = 0; i < num; i++) {
+		if (n[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool base58_prefix_ranges(const std::string& prefix, std::size_t len, std::vector<base58_range_t>& ranges) {
+
+	// One byte of headroom above the payload.
+	const std::size_t width = len + 1;
+	const std::size_t max_digits = base58_encoded_size(len);
+	_bignum value(width, 0);
+
+	ranges.clear();
+
+	// A leading '1' is a zero byte, not a digit.
+	if (prefix.empty() || prefix[0] == '1') {
+		return false;
+	}
+
+	for (std::size_t i = 0; i < prefix.size(); i++) {
+		int8_t d = internal::base58_table[(uint8_t) prefix[i]];
+		if (d < 0) {
+			return false;
+		}
+
+		// Saturate, the prefix is longer than any encoding anyway.
+		if (!_mul_add(value, 58, d)) {
+			return true;
+		}
+	}
+
+	// An encoding that is `digits` characters long and starts with `prefix` has a value in:
+	//   [prefix * 58^k, (prefix + 1) * 58^k - 1] where k = digits - prefix.size()
+	for (std::size_t k = 0; prefix.size() + k <= max_digits; k++) {
+		base58_range_t r;
+		_bignum lo(value), hi(value);
+		bool hi_ok;
+
+		for (std::size_t i = 0; i < k; i++) {
+			if (!_mul_add(lo, 58, 0)) {
+				return true;
+			}
+		}
+
+		// Outside of the payload range, longer encodings are even larger.
+		if (!_zero_prefix(lo, width - len)) {
+			break;
+		}
+
+		// Payloads with leading zero bytes are encoded with a leading '1'.
+		if (len > 0 && _zero_prefix(lo, width - len + 1)) {
+			std::fill(lo.begin(), lo.end(), 0);
+			lo[width - len] = 1;
+		}
+
+		hi_ok = _mul_add(hi, 1, 1);
+		for (std::size_t i = 0; hi_ok && i < k; i++) {
+			hi_ok = _mul_add(hi, 58, 0);
+		}
+
+		if (hi_ok) {
+			_sub1(hi);
+		}
+
+		// Clamp to the largest payload.
+		if (!hi_ok || !_zero_prefix(hi, width - len)) {
+			std::fill(hi.begin(), hi.end(), 0xff);
+		}
+
+		if (lo > hi) {
+			continue;
+		}
+
+		r.first.assign(lo.begin() + (width - len), lo.end());
+		r.last.assign(hi.begin() + (width - len), hi.end());
+		ranges.push_back(r);
+	}
+
+	return true;
+}
+
+} // namespace libeosio
@@ -0,0 +1,115 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include "cpu.hpp"
+
+#if defined(LIBEOSIO_SIMD_X86)
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace libeosio { namespace internal {
+
+#if defined(LIBEOSIO_SIMD_X86)
+
+static void _cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+	int r[4];
+	__cpuidex(r, leaf, subleaf);
+	for (int i = 0; i < 4; i++) regs[i] = r[i];
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t _xgetbv() {
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t lo, hi;
+	__asm__ volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+	return ((uint64_t) hi << 32) | lo;
+#endif
+}
+
+static cpu_features _detect() {
+	cpu_features f = { false, false, false, false };
+	uint32_t regs[4];
+	uint64_t xcr0 = 0;
+	bool avx;
+
+	_cpuid(0, 0, regs);
+	uint32_t max_leaf = regs[0];
+
+	if (max_leaf < 1) {
+		return f;
+	}
+
+	_cpuid(1, 0, regs);
+	f.sse41 = (regs[2] >> 19) & 1;
+	avx = (regs[2] >> 28) & 1;
+
+	// OSXSAVE: the OS uses XSAVE, so XCR0 tells what register state it preserves.
+	if ((regs[2] >> 27) & 1) {
+		xcr0 = _xgetbv();
+	}
+
+	if (max_leaf < 7) {
+		return f;
+	}
+
+	_cpuid(7, 0, regs);
+	// AVX, and XMM and YMM state
+	if (avx && (xcr0 & 0x6) == 0x6) {
+		f.avx2 = (regs[1] >> 5) & 1;
+
+		// opmask, ZMM_Hi256 and Hi16_ZMM state
+		if ((xcr0 & 0xe0) == 0xe0) {
+			f.avx512bw = ((regs[1] >> 16) & 1) && ((regs[1] >> 30) & 1);
+		}
+	}
+	f.sha = f.sse41 && ((regs[1] >> 29) & 1);
+
+	return f;
+}
+
+#else
+
+static cpu_features _detect() {
+	cpu_features f = { false, false, false, false };
+	return f;
+}
+
+#endif /* LIBEOSIO_SIMD_X86 */
+
+const cpu_features& cpu_get_features() {
+	// Initialization of function local statics is thread safe.
+	static const cpu_features features = _detect();
+	return features;
+}
+
+}} // namespace libeosio::internal
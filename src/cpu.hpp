@@ -0,0 +1,49 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_CPU_H
+#define LIBEOSIO_CPU_H
+
+namespace libeosio { namespace internal {
+
+/**
+ * CPU features used to select SIMD kernels at runtime.
+ *
+ * A feature is only reported if both the cpu and the operating system supports it
+ * (eg. the OS saves the AVX registers on context switch).
+ */
+struct cpu_features {
+	bool sse41;
+	bool avx2;
+	bool avx512bw;
+	bool sha;
+};
+
+/**
+ * Returns the features of the running cpu. Detection is done once on first call.
+ */
+const cpu_features& cpu_get_features();
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_CPU_H */
@@ -21,7 +21,115 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <libeosio/ec.hpp>
+#include "ec_backend.hpp"
+#include "parallel.hpp"
+
+namespace libeosio {
+
+// Fewest signatures worth giving a thread of its own, recovering them takes a few ms.
+#define RECOVER_MIN_CHUNK 64
+
+// Default context of each thread, so the free functions never share state between threads.
+static thread_local std::unique_ptr<ec_context> _default_context;
+
+ec_context& ec_default_context() {
+
+	ec_backend_t backend = ec_get_backend();
+
+	// Made again when another backend was selected since.
+	if (!_default_context || _default_context->backend() != backend) {
+		_default_context.reset(new ec_context(backend));
+	}
+	return *_default_context;
+}
+
+int ec_init(ec_backend_t backend) {
+
+	if (internal::ec_backend_select(backend) == NULL) {
+		return -1;
+	}
+
+	return ec_default_context().valid() ? 0 : -1;
+}
+
+void ec_shutdown() {
+	_default_context.reset();
+}
+
+int ec_generate_privkey(ec_privkey_t *priv) {
+	return ec_default_context().generate_privkey(priv);
+}
+
+int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
+	return ec_default_context().get_publickey(priv, pub);
+}
+
+int ec_generate_key(struct ec_keypair *pair) {
+	return ec_default_context().generate_key(pair);
+}
+
+int ec_generate_keys_sequential(struct ec_keypair *pairs, std::size_t count) {
+	return ec_default_context().generate_keys_sequential(pairs, count);
+}
+
+int ec_derive_keys_sequential(const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count) {
+	return ec_default_context().derive_keys_sequential(base, offset, pairs, count);
+}
+
+int ecdsa_sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
+	return ec_default_context().sign(key, digest, sig);
+}
+
+int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key) {
+	return ec_default_context().verify(digest, sig, key);
+}
+
+int ecdsa_verify_prepared(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_prepared& key) {
+	return ec_default_context().verify_prepared(digest, sig, key);
+}
+
+int ecdsa_verify_batch(const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid) {
+	return ec_default_context().verify_batch(digests, sigs, keys, count, valid);
+}
+
+int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key) {
+	return ec_default_context().recover(digest, sig, key);
+}
+
+int ecdsa_recover_batch(const sha256_t* digests, const ec_signature_t* sigs, std::size_t count,
+	ec_pubkey_t* keys, int* status, unsigned int threads) {
+
+	std::size_t n = std::min<std::size_t>(internal::parallel_threads(threads), count / RECOVER_MIN_CHUNK + 1);
+	std::atomic<bool> failed(false);
+
+	// Every thread recovers a contiguous part of the signatures.
+	internal::parallel_for(n, [&](std::size_t t) {
+
+		ec_context& ctx = ec_default_context();
+		std::size_t first = count * t / n, last = count * (t + 1) / n;
+		bool ok = true;
+
+		for (std::size_t i = first; i < last; i++) {
+			status[i] = ctx.recover(digests + i, sigs[i], keys[i]);
+			if (status[i] != 0) {
+				keys[i].fill(0);
+				ok = false;
+			}
+		}
+
+		if (!ok) {
+			failed = true;
+		}
+	});
+
+	return failed ? -1 : 0;
+}
+
+} // namespace libeosio
 
 std::ostream& _hex(std::ostream& os, const unsigned char *b, std::size_t sz) {
 	os << "[ " << std::hex;
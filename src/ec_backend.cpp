@@ -0,0 +1,410 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <libeosio/ec.hpp>
+#include "ec_backend.hpp"
+
+namespace libeosio {
+
+namespace internal {
+
+// Compiled in backends in order of preference.
+static const ec_backend* const _backends[] = {
+#if defined(LIBEOSIO_EC_LIBSECP256K1)
+	&ec_backend_libsecp256k1,
+#endif
+#if defined(LIBEOSIO_EC_OPENSSL)
+	&ec_backend_openssl,
+#endif
+};
+
+#define BACKEND_COUNT (sizeof(_backends) / sizeof(_backends[0]))
+
+static std::atomic<const ec_backend*> _selected(nullptr);
+
+// Self-test result of each backend (by id): 0 not run, 1 passed, -1 failed.
+static std::atomic<int> _tested[EC_BACKEND_OPENSSL + 1];
+
+// Known answer of the self-test, a private key and its public key.
+static const ec_privkey_t _test_key = {
+	0xf0, 0x2d, 0x00, 0x72, 0x8a, 0x7a, 0x93, 0x86, 0xaf, 0xbe, 0x19, 0xab, 0x79, 0x8c, 0xa1, 0x61,
+	0xab, 0x96, 0x74, 0x7f, 0xe5, 0x97, 0x19, 0x07, 0xb1, 0xc8, 0x65, 0x63, 0xc8, 0x11, 0xe6, 0x74
+};
+
+static const ec_pubkey_t _test_pub = {
+	0x03, 0x15, 0x93, 0x8a, 0x8e, 0x1d, 0x57, 0x84, 0x9f, 0xab, 0x07, 0x18, 0x67, 0xb5, 0x0c, 0xda,
+	0xb0, 0x77, 0x62, 0x29, 0xb6, 0x43, 0xb8, 0x67, 0x56, 0xc7, 0xb3, 0xe8, 0x7f, 0xe6, 0x08, 0xf8,
+	0x4b
+};
+
+static const ec_backend* _find(const ec_backend* const* list, std::size_t count, ec_backend_t backend) {
+	for (std::size_t i = 0; i < count; i++) {
+		if (list[i]->id == backend) {
+			return list[i];
+		}
+	}
+	return NULL;
+}
+
+bool ec_backend_self_test(const ec_backend *b) {
+
+	sha256_t digest = { 0x01, 0x02, 0x03 }, other = { 0x04, 0x05, 0x06 };
+	ec_signature_t sig;
+	ec_pubkey_t pub;
+	void *ctx;
+	bool ok;
+
+	if ((ctx = b->context_new()) == NULL) {
+		return false;
+	}
+
+	ok = b->get_publickey(ctx, &_test_key, &pub) == 0 && pub == _test_pub
+		&& b->sign(ctx, _test_key, &digest, sig) == 0
+		&& b->verify(ctx, &digest, sig, _test_pub) == 0
+		&& b->verify(ctx, &other, sig, _test_pub) != 0
+		&& b->recover(ctx, &digest, sig, pub) == 0 && pub == _test_pub;
+
+	b->context_free(ctx);
+	return ok;
+}
+
+static bool _passes(const ec_backend *b) {
+
+	int r = _tested[b->id].load();
+
+	if (r == 0) {
+		r = ec_backend_self_test(b) ? 1 : -1;
+		_tested[b->id] = r;
+	}
+	return r > 0;
+}
+
+// Backend named by the LIBEOSIO_EC_BACKEND environment variable.
+static ec_backend_t _env_backend() {
+
+	const char *name = std::getenv("LIBEOSIO_EC_BACKEND");
+
+	for (std::size_t i = 0; name && i < BACKEND_COUNT; i++) {
+		if (std::strcmp(name, _backends[i]->name) == 0) {
+			return _backends[i]->id;
+		}
+	}
+	return EC_BACKEND_DEFAULT;
+}
+
+const ec_backend* ec_backend_get(ec_backend_t backend) {
+
+	const ec_backend *b;
+
+	if (backend != EC_BACKEND_DEFAULT) {
+		return _find(_backends, BACKEND_COUNT, backend);
+	}
+
+	if ((b = _selected.load()) == NULL) {
+		b = ec_backend_select(EC_BACKEND_DEFAULT);
+	}
+	return b;
+}
+
+const ec_backend* ec_backend_select(ec_backend_t backend) {
+
+	const ec_backend *b;
+
+	if (backend == EC_BACKEND_DEFAULT) {
+		backend = _env_backend();
+	}
+
+	if ((b = ec_backend_pick(_backends, BACKEND_COUNT, backend, _passes)) != NULL) {
+		_selected = b;
+	}
+	return b;
+}
+
+const ec_backend* ec_backend_pick(const ec_backend* const* list, std::size_t count,
+	ec_backend_t backend, bool (*passes)(const ec_backend*)) {
+
+	// The requested backend first, then the others in order of preference.
+	const ec_backend *b = _find(list, count, backend);
+
+	if (b && passes(b)) {
+		return b;
+	}
+
+	for (std::size_t i = 0; i < count; i++) {
+		if (passes(list[i])) {
+			return list[i];
+		}
+	}
+	return NULL;
+}
+
+} // namespace internal
+
+const char* ec_backend_name(ec_backend_t backend) {
+	switch (backend) {
+	case EC_BACKEND_LIBSECP256K1:
+		return "libsecp256k1";
+	case EC_BACKEND_OPENSSL:
+		return "openssl";
+	case EC_BACKEND_DEFAULT:
+		return ec_get_backend() != EC_BACKEND_DEFAULT ? ec_backend_name(ec_get_backend()) : NULL;
+	}
+	return NULL;
+}
+
+bool ec_backend_available(ec_backend_t backend) {
+	const internal::ec_backend *b = internal::ec_backend_get(backend);
+	return b && internal::_passes(b);
+}
+
+ec_backend_t ec_get_backend() {
+	const internal::ec_backend *b = internal::ec_backend_get(EC_BACKEND_DEFAULT);
+	return b ? b->id : EC_BACKEND_DEFAULT;
+}
+
+// State of the public classes, the backend state is opaque.
+struct ec_context::impl {
+	const internal::ec_backend *b;
+	void *ctx;   // NULL if the backend state could not be created.
+};
+
+struct ec_pubkey_prepared::impl {
+	const internal::ec_backend *b;
+	void *k;
+	ec_pubkey_t key;
+};
+
+struct ec_signer::impl {
+	ec_context ctx;
+	void *key;
+	ec_pubkey_t pub;
+
+	impl(ec_backend_t backend) : ctx(backend), key(NULL), pub() {}
+};
+
+// --------------------------------
+//  Context
+// --------------------------------
+
+ec_context::ec_context(ec_backend_t backend) : p(new impl()) {
+	p->b = internal::ec_backend_get(backend);
+	p->ctx = p->b ? p->b->context_new() : NULL;
+}
+
+ec_context::~ec_context() {
+	if (p->ctx) {
+		p->b->context_free(p->ctx);
+	}
+	delete p;
+}
+
+bool ec_context::valid() const {
+	return p->ctx != NULL;
+}
+
+ec_backend_t ec_context::backend() const {
+	return p->b ? p->b->id : EC_BACKEND_DEFAULT;
+}
+
+void ec_context::set_randomize_interval(std::size_t keys) {
+	if (p->ctx) {
+		p->b->set_randomize_interval(p->ctx, keys);
+	}
+}
+
+int ec_context::generate_privkey(ec_privkey_t *priv) {
+	return p->ctx ? p->b->generate_privkey(p->ctx, priv) : -1;
+}
+
+int ec_context::get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
+	return p->ctx ? p->b->get_publickey(p->ctx, priv, pub) : -1;
+}
+
+int ec_context::generate_key(struct ec_keypair *pair) {
+	return p->ctx ? p->b->generate_key(p->ctx, pair) : -1;
+}
+
+int ec_context::generate_keys_sequential(struct ec_keypair *pairs, std::size_t count) {
+
+	ec_privkey_t base;
+	int rc;
+
+	if (generate_privkey(&base) < 0) {
+		return -1;
+	}
+
+	rc = derive_keys_sequential(base, 0, pairs, count);
+	std::memset(base.data(), 0, base.size());
+	return rc;
+}
+
+int ec_context::derive_keys_sequential(const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count) {
+	return p->ctx ? p->b->derive_keys_sequential(p->ctx, base, offset, pairs, count) : -1;
+}
+
+int ec_context::sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
+	return p->ctx ? p->b->sign(p->ctx, key, digest, sig) : -1;
+}
+
+int ec_context::verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key) {
+	return p->ctx ? p->b->verify(p->ctx, digest, sig, key) : -1;
+}
+
+int ec_context::verify_batch(const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid) {
+
+	if (!p->ctx) {
+		if (valid) {
+			std::fill(valid, valid + count, false);
+		}
+		return -1;
+	}
+
+	return p->b->verify_batch(p->ctx, digests, sigs, keys, count, valid);
+}
+
+int ec_context::verify_prepared(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_prepared& key) {
+
+	if (!p->ctx || !key.p->k) {
+		return -1;
+	}
+
+	// Prepared by another backend, only the key itself is of use.
+	if (key.p->b != p->b) {
+		return verify(digest, sig, key.p->key);
+	}
+
+	return p->b->verify_prepared(p->ctx, digest, sig, key.p->k);
+}
+
+int ec_context::recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key) {
+	return p->ctx ? p->b->recover(p->ctx, digest, sig, key) : -1;
+}
+
+// --------------------------------
+//  Prepared public key
+// --------------------------------
+
+ec_pubkey_prepared::ec_pubkey_prepared(ec_backend_t backend) : p(new impl()) {
+	p->b = internal::ec_backend_get(backend);
+}
+
+ec_pubkey_prepared::~ec_pubkey_prepared() {
+	if (p->k) {
+		p->b->prepared_free(p->k);
+	}
+	delete p;
+}
+
+int ec_pubkey_prepared::set(const ec_pubkey_t& key, bool precompute) {
+
+	if (p->k) {
+		p->b->prepared_free(p->k);
+		p->k = NULL;
+	}
+	p->key.fill(0);
+
+	if (!p->b || (p->k = p->b->prepared_new(key, precompute)) == NULL) {
+		return -1;
+	}
+
+	p->key = key;
+	return 0;
+}
+
+bool ec_pubkey_prepared::valid() const {
+	return p->k != NULL;
+}
+
+const ec_pubkey_t& ec_pubkey_prepared::key() const {
+	return p->key;
+}
+
+// --------------------------------
+//  Signer
+// --------------------------------
+
+ec_signer::ec_signer(ec_backend_t backend) : p(new impl(backend)) {
+}
+
+ec_signer::~ec_signer() {
+	if (p->key) {
+		p->ctx.p->b->signer_free(p->key);
+	}
+	delete p;
+}
+
+int ec_signer::set_key(const ec_privkey_t& key) {
+
+	const internal::ec_backend *b = p->ctx.p->b;
+
+	if (p->key) {
+		b->signer_free(p->key);
+		p->key = NULL;
+	}
+	p->pub.fill(0);
+
+	if (!p->ctx.valid() || (p->key = b->signer_new(p->ctx.p->ctx, key)) == NULL) {
+		return -1;
+	}
+
+	if (p->ctx.get_publickey(&key, &p->pub) < 0) {
+		b->signer_free(p->key);
+		p->key = NULL;
+		p->pub.fill(0);
+		return -1;
+	}
+
+	return 0;
+}
+
+bool ec_signer::valid() const {
+	return p->key != NULL;
+}
+
+const ec_pubkey_t& ec_signer::pubkey() const {
+	return p->pub;
+}
+
+int ec_signer::sign(const sha256_t* digest, ec_signature_t& sig) {
+
+	if (!p->key) {
+		return -1;
+	}
+
+	return p->ctx.p->b->signer_sign(p->ctx.p->ctx, p->key, digest, sig);
+}
+
+int ec_signer::sign_many(const sha256_t* digests, std::size_t count, ec_signature_t* sigs) {
+	for (std::size_t i = 0; i < count; i++) {
+		if (sign(digests + i, sigs[i]) < 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+} // namespace libeosio
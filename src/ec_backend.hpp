@@ -0,0 +1,110 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_EC_BACKEND_H
+#define LIBEOSIO_EC_BACKEND_H
+
+#include <cstddef>
+#include <cstdint>
+#include <libeosio/ec.hpp>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Elliptic curve backend
+ *
+ * Function table of one elliptic curve implementation. The public classes dispatch
+ * through it, so several implementations can be compiled into the library and one
+ * picked at runtime.
+ *
+ * State is opaque to the caller: `ctx` is made by context_new(), `signer` by
+ * signer_new() and `key` by prepared_new(), the *_new() functions return NULL on
+ * failure. Functions have the contract of the ec_context method with the same name
+ * and are only called with valid state.
+ */
+struct ec_backend {
+	ec_backend_t id;
+	const char *name;
+
+	void* (*context_new)();
+	void (*context_free)(void *ctx);
+	void (*set_randomize_interval)(void *ctx, std::size_t keys);
+
+	int (*generate_privkey)(void *ctx, ec_privkey_t *priv);
+	int (*get_publickey)(void *ctx, const ec_privkey_t *priv, ec_pubkey_t* pub);
+	int (*generate_key)(void *ctx, struct ec_keypair *pair);
+	int (*derive_keys_sequential)(void *ctx, const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count);
+
+	int (*sign)(void *ctx, const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig);
+	int (*verify)(void *ctx, const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key);
+	int (*verify_batch)(void *ctx, const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid);
+	int (*verify_prepared)(void *ctx, const sha256_t* digest, const ec_signature_t& sig, const void *key);
+	int (*recover)(void *ctx, const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key);
+
+	// A validated private key, signs with the context it was made with.
+	void* (*signer_new)(void *ctx, const ec_privkey_t& key);
+	void (*signer_free)(void *signer);
+	int (*signer_sign)(void *ctx, void *signer, const sha256_t* digest, ec_signature_t& sig);
+
+	// A parsed public key, not modified by verify_prepared().
+	void* (*prepared_new)(const ec_pubkey_t& key, bool precompute);
+	void (*prepared_free)(void *key);
+};
+
+/**
+ * Returns the table of `backend` or NULL if it is not compiled in. EC_BACKEND_DEFAULT
+ * is the selected backend, the default one is selected on first use.
+ */
+const ec_backend* ec_backend_get(ec_backend_t backend);
+
+/**
+ * Select `backend` for EC_BACKEND_DEFAULT, falls back to another backend if it is not
+ * compiled in or fails its self-test. Returns the selected backend, NULL if none passes
+ * its self-test (the selection is not changed then).
+ */
+const ec_backend* ec_backend_select(ec_backend_t backend);
+
+/**
+ * Derive, sign, verify and recover with a known key. Returns false if any result is wrong.
+ */
+bool ec_backend_self_test(const ec_backend *b);
+
+/**
+ * Selection rule of ec_backend_select(): `backend` if it is in `list` and `passes`,
+ * otherwise the first backend in `list` (order of preference) that passes.
+ * Returns NULL if none passes.
+ */
+const ec_backend* ec_backend_pick(const ec_backend* const* list, std::size_t count,
+	ec_backend_t backend, bool (*passes)(const ec_backend*));
+
+#if defined(LIBEOSIO_EC_LIBSECP256K1)
+extern const ec_backend ec_backend_libsecp256k1;
+#endif
+
+#if defined(LIBEOSIO_EC_OPENSSL)
+extern const ec_backend ec_backend_openssl;
+#endif
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_EC_BACKEND_H */
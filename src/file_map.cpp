@@ -0,0 +1,127 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "file_map.hpp"
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace libeosio { namespace internal {
+
+file_map::file_map() :
+	m_data(NULL),
+	m_size(0),
+	m_mapped(false) {
+}
+
+file_map::~file_map() {
+	close();
+}
+
+#if defined(_WIN32)
+
+int file_map::open(const std::string& filename) {
+
+	close();
+
+	std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+	if (!file) {
+		return -1;
+	}
+
+	m_buffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	if (!file.read(m_buffer.data(), m_buffer.size())) {
+		m_buffer.clear();
+		return -1;
+	}
+
+	m_data = m_buffer.data();
+	m_size = m_buffer.size();
+	return 0;
+}
+
+#else
+
+int file_map::open(const std::string& filename) {
+
+	struct stat st;
+	void *ptr;
+	int fd;
+
+	close();
+
+	fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+
+	if (fstat(fd, &st) < 0) {
+		::close(fd);
+		return -1;
+	}
+
+	// Empty files can not be mapped.
+	if (st.st_size == 0) {
+		::close(fd);
+		return 0;
+	}
+
+	ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (ptr == MAP_FAILED) {
+		return -1;
+	}
+
+	// The file is read front to back.
+	madvise(ptr, st.st_size, MADV_SEQUENTIAL);
+
+	m_data = static_cast<const char*>(ptr);
+	m_size = st.st_size;
+	m_mapped = true;
+	return 0;
+}
+
+#endif /* _WIN32 */
+
+void file_map::close() {
+
+#if !defined(_WIN32)
+	if (m_mapped) {
+		munmap(const_cast<char*>(m_data), m_size);
+	}
+#endif
+
+	m_buffer.clear();
+	m_data = NULL;
+	m_size = 0;
+	m_mapped = false;
+}
+
+}} // namespace libeosio::internal
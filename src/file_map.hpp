@@ -0,0 +1,66 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_FILE_MAP_H
+#define LIBEOSIO_FILE_MAP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Read only view of a file's content.
+ *
+ * The file is memory mapped where supported, otherwise it is read into memory.
+ */
+class file_map {
+public:
+	file_map();
+	~file_map();
+
+	/**
+	 * Map `filename`, returns 0 on success and -1 on error.
+	 */
+	int open(const std::string& filename);
+
+	void close();
+
+	const char* data() const { return m_data; }
+	std::size_t size() const { return m_size; }
+
+private:
+	// Not copyable.
+	file_map(const file_map&);
+	file_map& operator=(const file_map&);
+
+	const char* m_data;
+	std::size_t m_size;
+	bool m_mapped;
+	std::vector<char> m_buffer;
+};
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_FILE_MAP_H */
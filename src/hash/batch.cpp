@@ -0,0 +1,306 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <libeosio/hash.hpp>
+#include "../cpu.hpp"
+#include "common.hpp"
+#include "transform.hpp"
+
+namespace libeosio {
+
+namespace internal {
+
+struct hash_batch_impl {
+	std::size_t lanes; // 0 if hashing one message at a time is faster.
+	std::size_t drain; // Finish the last messages one at a time once this few lanes are busy.
+	hash_batch_kernel_t kernel;
+};
+
+// With SHA-NI a single message hashes faster than in the 4 or 8 lane kernels, but the
+// 16 lane kernel is still ahead as long as at least half of its lanes are busy.
+static hash_batch_impl _select_sha256() {
+	hash_batch_impl impl = { 0, 0, NULL };
+#if defined(LIBEOSIO_SIMD_X86)
+	const cpu_features& cpu = cpu_get_features();
+
+	if (cpu.avx512bw) {
+		impl.lanes = 16;
+		impl.drain = cpu.sha ? 8 : 1;
+		impl.kernel = sha256_batch_avx512;
+	} else if (cpu.avx2 && !cpu.sha) {
+		impl.lanes = 8;
+		impl.drain = 1;
+		impl.kernel = sha256_batch_avx2;
+	} else if (cpu.sse41 && !cpu.sha) {
+		impl.lanes = 4;
+		impl.drain = 1;
+		impl.kernel = sha256_batch_sse41;
+	}
+#endif
+	return impl;
+}
+
+static hash_batch_impl _select_ripemd160() {
+	hash_batch_impl impl = { 0, 0, NULL };
+#if defined(LIBEOSIO_SIMD_X86)
+	const cpu_features& cpu = cpu_get_features();
+
+	if (cpu.avx512bw) {
+		impl.lanes = 16;
+		impl.kernel = ripemd160_batch_avx512;
+	} else if (cpu.avx2) {
+		impl.lanes = 8;
+		impl.kernel = ripemd160_batch_avx2;
+	} else if (cpu.sse41) {
+		impl.lanes = 4;
+		impl.kernel = ripemd160_batch_sse41;
+	}
+	impl.drain = 1;
+#endif
+	return impl;
+}
+
+// Schedules messages of any length onto the lanes of a multi-buffer kernel.
+//
+// Every lane works through its own message block by block: first the full blocks
+// straight from the message, then the padded tail from a lane buffer. When a lane
+// finishes a message it stores the hash and picks up the next one, so messages of
+// different lengths keep all lanes busy until the queue runs dry. Idle lanes hash
+// a dummy block. Once only a few lanes are left, they are finished one at a time
+// with the scalar transform instead of running the full width kernel for them.
+//
+// `Passes` is 2 for sha256d, the second pass hashes the first digest in the same lane.
+template <std::size_t Words, bool BigEndian, unsigned Passes>
+class hash_batch_scheduler {
+public:
+	typedef void (*transform_t)(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+	hash_batch_scheduler(const uint32_t *iv, const unsigned char *const *data, const std::size_t *len,
+		std::size_t count, unsigned char *out) :
+		iv(iv), data(data), len(len), count(count), out(out), next(0) {}
+
+	void run(const hash_batch_impl& impl, transform_t transform) {
+
+		static const unsigned char idle[64] = { 0 };
+		const std::size_t lanes = impl.lanes;
+		uint32_t state[Words * HASH_BATCH_MAX_LANES];
+		const unsigned char *blocks[HASH_BATCH_MAX_LANES];
+		std::size_t active = 0;
+
+		for (std::size_t k = 0; k < lanes; k++) {
+			if (_start(lane[k], state + k, lanes)) {
+				active++;
+			}
+		}
+
+		while (active && (next < count || active > impl.drain)) {
+			for (std::size_t k = 0; k < lanes; k++) {
+				blocks[k] = lane[k].msg < count ? lane[k].block : idle;
+			}
+
+			impl.kernel(state, blocks);
+
+			for (std::size_t k = 0; k < lanes; k++) {
+				if (lane[k].msg < count) {
+					lane[k].block += 64;
+					if (--lane[k].left == 0 && !_advance(lane[k], state + k, lanes)) {
+						active--;
+					}
+				}
+			}
+		}
+
+		// Drain the last lanes.
+		for (std::size_t k = 0; k < lanes && active; k++) {
+			uint32_t s[Words];
+
+			if (lane[k].msg >= count) {
+				continue;
+			}
+			for (std::size_t i = 0; i < Words; i++) {
+				s[i] = state[i * lanes + k];
+			}
+			do {
+				transform(s, lane[k].block, lane[k].left);
+			} while (_advance(lane[k], s, 1));
+			active--;
+		}
+	}
+
+private:
+	struct _lane {
+		std::size_t msg;            // Message being hashed, `count` if the lane is idle.
+		const unsigned char *block; // Next block.
+		std::size_t left;           // Blocks left from `block` on.
+		std::size_t tail;           // Padded blocks in `buf` after those.
+		unsigned pass;
+		unsigned char buf[128];
+	};
+
+	// Pad the last `n` bytes of a `size` byte message into `buf`.
+	static std::size_t _pad(unsigned char *buf, const unsigned char *rest, std::size_t n, std::size_t size) {
+
+		std::size_t blocks = n < 56 ? 1 : 2;
+
+		std::memset(buf, 0, sizeof(_lane::buf));
+		std::memcpy(buf, rest, n);
+		buf[n] = 0x80;
+		if (BigEndian) {
+			write_be64(buf + blocks * 64 - 8, (uint64_t) size << 3);
+		} else {
+			write_le64(buf + blocks * 64 - 8, (uint64_t) size << 3);
+		}
+		return blocks;
+	}
+
+	// Begin hashing `size` bytes at `p` into the state column `s`.
+	void _begin(_lane& l, uint32_t *s, std::size_t stride, const unsigned char *p, std::size_t size) {
+
+		std::size_t full = size / 64;
+
+		for (std::size_t i = 0; i < Words; i++) {
+			s[i * stride] = iv[i];
+		}
+
+		l.tail = _pad(l.buf, p + full * 64, size % 64, size);
+		if (full) {
+			l.block = p;
+			l.left = full;
+		} else {
+			l.block = l.buf;
+			l.left = l.tail;
+			l.tail = 0;
+		}
+	}
+
+	// Take the next message from the queue, returns false if there is none.
+	bool _start(_lane& l, uint32_t *s, std::size_t stride) {
+
+		if (next == count) {
+			l.msg = count;
+			return false;
+		}
+
+		l.msg = next++;
+		l.pass = 0;
+		_begin(l, s, stride, data[l.msg], len[l.msg]);
+		return true;
+	}
+
+	// Called when the current blocks of a lane are done, returns false if the lane is idle.
+	bool _advance(_lane& l, uint32_t *s, std::size_t stride) {
+
+		if (l.tail) {
+			l.block = l.buf;
+			l.left = l.tail;
+			l.tail = 0;
+			return true;
+		}
+
+		unsigned char digest[Words * 4];
+
+		for (std::size_t i = 0; i < Words; i++) {
+			if (BigEndian) {
+				write_be32(digest + i * 4, s[i * stride]);
+			} else {
+				write_le32(digest + i * 4, s[i * stride]);
+			}
+		}
+
+		if (++l.pass < Passes) {
+			_begin(l, s, stride, digest, sizeof(digest));
+			return true;
+		}
+
+		std::memcpy(out + l.msg * sizeof(digest), digest, sizeof(digest));
+		return _start(l, s, stride);
+	}
+
+	const uint32_t *iv;
+	const unsigned char *const *data;
+	const std::size_t *len;
+	std::size_t count;
+	unsigned char *out;
+	std::size_t next;
+	_lane lane[HASH_BATCH_MAX_LANES];
+};
+
+static const hash_batch_impl& _sha256_impl() {
+	static const hash_batch_impl impl = _select_sha256();
+	return impl;
+}
+
+static const hash_batch_impl& _ripemd160_impl() {
+	static const hash_batch_impl impl = _select_ripemd160();
+	return impl;
+}
+
+} // namespace internal
+
+void sha256_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, sha256_t* out) {
+
+	const internal::hash_batch_impl& impl = internal::_sha256_impl();
+
+	if (!impl.lanes) {
+		for (std::size_t i = 0; i < count; i++) {
+			sha256(data[i], len[i], out + i);
+		}
+		return;
+	}
+
+	internal::hash_batch_scheduler<8, true, 1> sched(internal::sha256_initial_state, data, len, count, *out);
+	sched.run(impl, internal::sha256_transform);
+}
+
+void sha256d_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, sha256_t* out) {
+
+	const internal::hash_batch_impl& impl = internal::_sha256_impl();
+
+	if (!impl.lanes) {
+		for (std::size_t i = 0; i < count; i++) {
+			sha256d(data[i], len[i], out + i);
+		}
+		return;
+	}
+
+	internal::hash_batch_scheduler<8, true, 2> sched(internal::sha256_initial_state, data, len, count, *out);
+	sched.run(impl, internal::sha256_transform);
+}
+
+void ripemd160_batch(const unsigned char *const *data, const std::size_t *len, std::size_t count, ripemd160_t* out) {
+
+	const internal::hash_batch_impl& impl = internal::_ripemd160_impl();
+
+	if (!impl.lanes) {
+		for (std::size_t i = 0; i < count; i++) {
+			ripemd160(data[i], len[i], out + i);
+		}
+		return;
+	}
+
+	internal::hash_batch_scheduler<5, false, 1> sched(internal::ripemd160_initial_state, data, len, count, *out);
+	sched.run(impl, internal::ripemd160_transform);
+}
+
+} // namespace libeosio
@@ -0,0 +1,59 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "batch_kernel.hpp"
+
+namespace libeosio { namespace internal {
+
+namespace {
+
+// 8 lanes of 32 bits.
+struct lanes_avx2 {
+	typedef __m256i type;
+	static const std::size_t size = 8;
+
+	static type set1(uint32_t x) { return _mm256_set1_epi32((int) x); }
+	static type load(const uint32_t *p) { return _mm256_loadu_si256((const __m256i*) p); }
+	static void store(uint32_t *p, type x) { _mm256_storeu_si256((__m256i*) p, x); }
+	static type vadd(type a, type b) { return _mm256_add_epi32(a, b); }
+	static type vand(type a, type b) { return _mm256_and_si256(a, b); }
+	static type vandnot(type a, type b) { return _mm256_andnot_si256(a, b); }
+	static type vor(type a, type b) { return _mm256_or_si256(a, b); }
+	static type vxor(type a, type b) { return _mm256_xor_si256(a, b); }
+	static type shr(type x, int n) { return _mm256_srli_epi32(x, n); }
+	static type rotl(type x, int n) { return _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - n)); }
+	static type rotr(type x, int n) { return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n)); }
+};
+
+} // namespace
+
+void sha256_batch_avx2(uint32_t *state, const unsigned char *const *blocks) {
+	sha256_batch_compress<lanes_avx2>(state, blocks);
+}
+
+void ripemd160_batch_avx2(uint32_t *state, const unsigned char *const *blocks) {
+	ripemd160_batch_compress<lanes_avx2>(state, blocks);
+}
+
+}} // namespace libeosio::internal
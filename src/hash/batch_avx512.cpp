@@ -0,0 +1,60 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "batch_kernel.hpp"
+
+namespace libeosio { namespace internal {
+
+namespace {
+
+// 16 lanes of 32 bits.
+struct lanes_avx512 {
+	typedef __m512i type;
+	static const std::size_t size = 16;
+
+	static type set1(uint32_t x) { return _mm512_set1_epi32((int) x); }
+	static type load(const uint32_t *p) { return _mm512_loadu_si512((const __m512i*) p); }
+	static void store(uint32_t *p, type x) { _mm512_storeu_si512((__m512i*) p, x); }
+	static type vadd(type a, type b) { return _mm512_add_epi32(a, b); }
+	static type vand(type a, type b) { return _mm512_and_si512(a, b); }
+	static type vandnot(type a, type b) { return _mm512_andnot_si512(a, b); }
+	static type vor(type a, type b) { return _mm512_or_si512(a, b); }
+	static type vxor(type a, type b) { return _mm512_xor_si512(a, b); }
+	static type shr(type x, int n) { return _mm512_srli_epi32(x, n); }
+	// Variable rotates, the immediate forms need a constant even in unoptimized builds.
+	static type rotl(type x, int n) { return _mm512_rolv_epi32(x, _mm512_set1_epi32(n)); }
+	static type rotr(type x, int n) { return _mm512_rorv_epi32(x, _mm512_set1_epi32(n)); }
+};
+
+} // namespace
+
+void sha256_batch_avx512(uint32_t *state, const unsigned char *const *blocks) {
+	sha256_batch_compress<lanes_avx512>(state, blocks);
+}
+
+void ripemd160_batch_avx512(uint32_t *state, const unsigned char *const *blocks) {
+	ripemd160_batch_compress<lanes_avx512>(state, blocks);
+}
+
+}} // namespace libeosio::internal
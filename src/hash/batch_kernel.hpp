@@ -0,0 +1,215 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_HASH_BATCH_KERNEL_H
+#define LIBEOSIO_HASH_BATCH_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include "common.hpp"
+#include "transform.hpp"
+
+// Multi-buffer compression functions: one block for each of `V::size` independent
+// messages, one message per vector lane. `V` is a vector of 32 bit lanes defined by
+// every kernel source file for its instruction set:
+//
+//   typedef ... type;
+//   static const std::size_t size;
+//   static type set1(uint32_t x);
+//   static type load(const uint32_t *p);
+//   static void store(uint32_t *p, type x);
+//   static type vadd(type a, type b);
+//   static type vand(type a, type b);
+//   static type vandnot(type a, type b); // ~a & b
+//   static type vor(type a, type b);
+//   static type vxor(type a, type b);
+//   static type shr(type x, int n);
+//   static type rotl(type x, int n);
+//   static type rotr(type x, int n);
+//
+// The kernels have internal linkage so the linker never merges the copies.
+namespace libeosio { namespace internal { namespace {
+
+// Transpose word `i` of every lane's block into one vector.
+template <class V, bool BigEndian>
+inline typename V::type batch_load_word(const unsigned char *const *blocks, int i) {
+
+	uint32_t w[V::size];
+
+	for (std::size_t k = 0; k < V::size; k++) {
+		w[k] = BigEndian ? read_be32(blocks[k] + i * 4) : read_le32(blocks[k] + i * 4);
+	}
+	return V::load(w);
+}
+
+/**
+ * `state` is 8 rows of `V::size` lanes, `blocks[k]` is the block of lane `k`.
+ */
+template <class V>
+inline void sha256_batch_compress(uint32_t *state, const unsigned char *const *blocks) {
+
+	typedef typename V::type T;
+	const std::size_t L = V::size;
+
+	T w[16];
+	T a = V::load(state + 0 * L), b = V::load(state + 1 * L), c = V::load(state + 2 * L), d = V::load(state + 3 * L);
+	T e = V::load(state + 4 * L), f = V::load(state + 5 * L), g = V::load(state + 6 * L), h = V::load(state + 7 * L);
+
+	for (int i = 0; i < 16; i++) {
+		w[i] = batch_load_word<V, true>(blocks, i);
+	}
+
+	// Message schedule, kept as a ring of 16 words.
+#define W(i) w[(i) & 15]
+#define SCHEDULE(i) \
+	W(i) = V::vadd(V::vadd(W(i), V::vxor(V::vxor(V::rotr(W((i) + 14), 17), V::rotr(W((i) + 14), 19)), V::shr(W((i) + 14), 10))), \
+		V::vadd(W((i) + 9), V::vxor(V::vxor(V::rotr(W((i) + 1), 7), V::rotr(W((i) + 1), 18)), V::shr(W((i) + 1), 3))))
+
+	// The variables are renamed by the caller instead of being moved.
+#define ROUND(a, b, c, d, e, f, g, h, i) { \
+		if ((i) >= 16) { SCHEDULE(i); } \
+		T t1 = V::vadd(V::vadd(h, V::vxor(V::vxor(V::rotr(e, 6), V::rotr(e, 11)), V::rotr(e, 25))), \
+			V::vadd(V::vxor(g, V::vand(e, V::vxor(f, g))), V::vadd(V::set1(sha256_k[(i)]), W(i)))); \
+		T t2 = V::vadd(V::vxor(V::vxor(V::rotr(a, 2), V::rotr(a, 13)), V::rotr(a, 22)), \
+			V::vor(V::vand(a, b), V::vand(c, V::vor(a, b)))); \
+		d = V::vadd(d, t1); \
+		h = V::vadd(t1, t2); \
+	}
+#define ROUND8(i) \
+	ROUND(a, b, c, d, e, f, g, h, (i) + 0) ROUND(h, a, b, c, d, e, f, g, (i) + 1) \
+	ROUND(g, h, a, b, c, d, e, f, (i) + 2) ROUND(f, g, h, a, b, c, d, e, (i) + 3) \
+	ROUND(e, f, g, h, a, b, c, d, (i) + 4) ROUND(d, e, f, g, h, a, b, c, (i) + 5) \
+	ROUND(c, d, e, f, g, h, a, b, (i) + 6) ROUND(b, c, d, e, f, g, h, a, (i) + 7)
+
+	ROUND8(0) ROUND8(8) ROUND8(16) ROUND8(24) ROUND8(32) ROUND8(40) ROUND8(48) ROUND8(56)
+
+#undef ROUND8
+#undef ROUND
+#undef SCHEDULE
+#undef W
+
+	V::store(state + 0 * L, V::vadd(V::load(state + 0 * L), a));
+	V::store(state + 1 * L, V::vadd(V::load(state + 1 * L), b));
+	V::store(state + 2 * L, V::vadd(V::load(state + 2 * L), c));
+	V::store(state + 3 * L, V::vadd(V::load(state + 3 * L), d));
+	V::store(state + 4 * L, V::vadd(V::load(state + 4 * L), e));
+	V::store(state + 5 * L, V::vadd(V::load(state + 5 * L), f));
+	V::store(state + 6 * L, V::vadd(V::load(state + 6 * L), g));
+	V::store(state + 7 * L, V::vadd(V::load(state + 7 * L), h));
+}
+
+// RIPEMD-160 message word selection and rotation amounts, left and right line.
+const unsigned char ripemd160_rl[80] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+	3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+	1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+	4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+const unsigned char ripemd160_rr[80] = {
+	5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+	6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+	15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+	8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+	12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+const unsigned char ripemd160_sl[80] = {
+	11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+	7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+	11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+	11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+	9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+const unsigned char ripemd160_sr[80] = {
+	8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+	9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+	9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+	15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+	8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+const uint32_t ripemd160_kl[5] = { 0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e };
+const uint32_t ripemd160_kr[5] = { 0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000 };
+
+template <class V>
+inline typename V::type ripemd160_batch_f(int j, typename V::type x, typename V::type y, typename V::type z) {
+	switch (j / 16) {
+	case 0: return V::vxor(V::vxor(x, y), z);
+	case 1: return V::vor(V::vand(x, y), V::vandnot(x, z));
+	case 2: return V::vxor(V::vor(x, V::vxor(y, V::set1(0xffffffff))), z);
+	case 3: return V::vor(V::vand(x, z), V::vandnot(z, y));
+	default: return V::vxor(x, V::vor(y, V::vxor(z, V::set1(0xffffffff))));
+	}
+}
+
+/**
+ * `state` is 5 rows of `V::size` lanes, `blocks[k]` is the block of lane `k`.
+ */
+template <class V>
+inline void ripemd160_batch_compress(uint32_t *state, const unsigned char *const *blocks) {
+
+	typedef typename V::type T;
+	const std::size_t L = V::size;
+
+	T w[16];
+	T al = V::load(state + 0 * L), bl = V::load(state + 1 * L), cl = V::load(state + 2 * L);
+	T dl = V::load(state + 3 * L), el = V::load(state + 4 * L);
+	T ar = al, br = bl, cr = cl, dr = dl, er = el;
+
+	for (int i = 0; i < 16; i++) {
+		w[i] = batch_load_word<V, false>(blocks, i);
+	}
+
+	// Fully unrolled so the table lookups and the choice of f() are resolved at compile time.
+#define STEP(j) { \
+		T t; \
+		t = V::vadd(V::rotl(V::vadd(V::vadd(al, ripemd160_batch_f<V>((j), bl, cl, dl)), \
+			V::vadd(w[ripemd160_rl[(j)]], V::set1(ripemd160_kl[(j) / 16]))), ripemd160_sl[(j)]), el); \
+		al = el; el = dl; dl = V::rotl(cl, 10); cl = bl; bl = t; \
+		t = V::vadd(V::rotl(V::vadd(V::vadd(ar, ripemd160_batch_f<V>(79 - (j), br, cr, dr)), \
+			V::vadd(w[ripemd160_rr[(j)]], V::set1(ripemd160_kr[(j) / 16]))), ripemd160_sr[(j)]), er); \
+		ar = er; er = dr; dr = V::rotl(cr, 10); cr = br; br = t; \
+	}
+#define STEP4(j) STEP(j) STEP(j + 1) STEP(j + 2) STEP(j + 3)
+#define STEP16(j) STEP4(j) STEP4(j + 4) STEP4(j + 8) STEP4(j + 12)
+
+	STEP16(0) STEP16(16) STEP16(32) STEP16(48) STEP16(64)
+
+#undef STEP16
+#undef STEP4
+#undef STEP
+
+	T t = V::vadd(V::load(state + 1 * L), V::vadd(cl, dr));
+	V::store(state + 1 * L, V::vadd(V::load(state + 2 * L), V::vadd(dl, er)));
+	V::store(state + 2 * L, V::vadd(V::load(state + 3 * L), V::vadd(el, ar)));
+	V::store(state + 3 * L, V::vadd(V::load(state + 4 * L), V::vadd(al, br)));
+	V::store(state + 4 * L, V::vadd(V::load(state + 0 * L), V::vadd(bl, cr)));
+	V::store(state + 0 * L, t);
+}
+
+}}} // namespace libeosio::internal::(anonymous)
+
+#endif /* LIBEOSIO_HASH_BATCH_KERNEL_H */
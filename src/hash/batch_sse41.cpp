@@ -0,0 +1,59 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "batch_kernel.hpp"
+
+namespace libeosio { namespace internal {
+
+namespace {
+
+// 4 lanes of 32 bits.
+struct lanes_sse41 {
+	typedef __m128i type;
+	static const std::size_t size = 4;
+
+	static type set1(uint32_t x) { return _mm_set1_epi32((int) x); }
+	static type load(const uint32_t *p) { return _mm_loadu_si128((const __m128i*) p); }
+	static void store(uint32_t *p, type x) { _mm_storeu_si128((__m128i*) p, x); }
+	static type vadd(type a, type b) { return _mm_add_epi32(a, b); }
+	static type vand(type a, type b) { return _mm_and_si128(a, b); }
+	static type vandnot(type a, type b) { return _mm_andnot_si128(a, b); }
+	static type vor(type a, type b) { return _mm_or_si128(a, b); }
+	static type vxor(type a, type b) { return _mm_xor_si128(a, b); }
+	static type shr(type x, int n) { return _mm_srli_epi32(x, n); }
+	static type rotl(type x, int n) { return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n)); }
+	static type rotr(type x, int n) { return _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n)); }
+};
+
+} // namespace
+
+void sha256_batch_sse41(uint32_t *state, const unsigned char *const *blocks) {
+	sha256_batch_compress<lanes_sse41>(state, blocks);
+}
+
+void ripemd160_batch_sse41(uint32_t *state, const unsigned char *const *blocks) {
+	ripemd160_batch_compress<lanes_sse41>(state, blocks);
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,69 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_HASH_COMMON_H
+#define LIBEOSIO_HASH_COMMON_H
+
+#include <cstdint>
+
+// Also used by kernels compiled with instruction set flags, internal linkage
+// keeps those copies from replacing the portable ones at link time.
+namespace libeosio { namespace internal { namespace {
+
+inline uint32_t rotl32(uint32_t x, int n) {
+	return (x << n) | (x >> (32 - n));
+}
+
+inline uint32_t rotr32(uint32_t x, int n) {
+	return (x >> n) | (x << (32 - n));
+}
+
+inline uint32_t read_be32(const unsigned char *p) {
+	return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+inline uint32_t read_le32(const unsigned char *p) {
+	return ((uint32_t) p[3] << 24) | ((uint32_t) p[2] << 16) | ((uint32_t) p[1] << 8) | p[0];
+}
+
+inline void write_be32(unsigned char *p, uint32_t v) {
+	p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+inline void write_le32(unsigned char *p, uint32_t v) {
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+inline void write_be64(unsigned char *p, uint64_t v) {
+	write_be32(p, v >> 32);
+	write_be32(p + 4, (uint32_t) v);
+}
+
+inline void write_le64(unsigned char *p, uint64_t v) {
+	write_le32(p, (uint32_t) v);
+	write_le32(p + 4, v >> 32);
+}
+
+}}} // namespace libeosio::internal::(anonymous)
+
+#endif /* LIBEOSIO_HASH_COMMON_H */
@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <libeosio/hash.hpp>
+#include "common.hpp"
+#include "transform.hpp"
+
+namespace libeosio {
+
+typedef void (*transform_t)(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+// Hash `len` bytes of `data` into `state`. Whole blocks are processed directly from
+// `data`, the rest is padded in a stack buffer. No context or buffering involved,
+// which matters for the short messages (33 - 69 bytes) hashed by this library.
+template <transform_t Transform, bool BigEndian>
+static void _hash(uint32_t *state, const unsigned char *data, std::size_t len) {
+
+	unsigned char tail[128] = { 0 };
+	std::size_t full = len / 64, rest = len % 64;
+	std::size_t size = rest < 56 ? 64 : 128;
+
+	if (full) {
+		Transform(state, data, full);
+	}
+
+	std::memcpy(tail, data + full * 64, rest);
+	tail[rest] = 0x80;
+	if (BigEndian) {
+		internal::write_be64(tail + size - 8, (uint64_t) len << 3);
+	} else {
+		internal::write_le64(tail + size - 8, (uint64_t) len << 3);
+	}
+
+	Transform(state, tail, size / 64);
+}
+
+static void _sha256(const unsigned char *data, std::size_t len, sha256_t* out) {
+
+	uint32_t s[8];
+
+	std::memcpy(s, internal::sha256_initial_state, sizeof(s));
+	_hash<internal::sha256_transform, true>(s, data, len);
+
+	for (int i = 0; i < 8; i++) {
+		internal::write_be32(*out + i * 4, s[i]);
+	}
+}
+
+sha256_t* sha256(const unsigned char *data, std::size_t len, sha256_t* out) {
+	_sha256(data, len, out);
+	return out;
+}
+
+sha256_t* sha256d(const unsigned char *data, std::size_t len, sha256_t* out) {
+	_sha256(data, len, out);
+	_sha256(*out, sizeof(*out), out);
+	return out;
+}
+
+ripemd160_t* ripemd160(const unsigned char *data, std::size_t len, ripemd160_t* out) {
+
+	uint32_t s[5];
+
+	std::memcpy(s, internal::ripemd160_initial_state, sizeof(s));
+	_hash<internal::ripemd160_transform, false>(s, data, len);
+
+	for (int i = 0; i < 5; i++) {
+		internal::write_le32(*out + i * 4, s[i]);
+	}
+	return out;
+}
+
+} // namespace libeosio
@@ -0,0 +1,172 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <libeosio/hash.hpp>
+#include "common.hpp"
+#include "transform.hpp"
+
+namespace libeosio {
+
+namespace {
+
+using namespace internal;
+
+// Message word selection.
+const unsigned char RL[80] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+	3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+	1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+	4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+const unsigned char RR[80] = {
+	5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+	6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+	15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+	8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+	12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+// Rotation amounts.
+const unsigned char SL[80] = {
+	11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+	7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+	11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+	11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+	9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+const unsigned char SR[80] = {
+	8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+	9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+	9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+	15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+	8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+const uint32_t KL[5] = { 0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e };
+const uint32_t KR[5] = { 0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000 };
+
+inline uint32_t f(int j, uint32_t x, uint32_t y, uint32_t z) {
+	switch (j / 16) {
+	case 0: return x ^ y ^ z;
+	case 1: return (x & y) | (~x & z);
+	case 2: return (x | ~y) ^ z;
+	case 3: return (x & z) | (y & ~z);
+	default: return x ^ (y | ~z);
+	}
+}
+
+} // namespace
+
+namespace internal {
+
+const uint32_t ripemd160_initial_state[5] = {
+	0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+};
+
+void ripemd160_transform(uint32_t *s, const unsigned char *data, std::size_t blocks) {
+
+	uint32_t w[16];
+
+	for (; blocks > 0; blocks--, data += 64) {
+		uint32_t al = s[0], bl = s[1], cl = s[2], dl = s[3], el = s[4];
+		uint32_t ar = al, br = bl, cr = cl, dr = dl, er = el;
+
+		for (int i = 0; i < 16; i++) {
+			w[i] = read_le32(data + i * 4);
+		}
+
+		// Fully unrolled so the table lookups and the choice of f() are resolved at compile time.
+#define STEP(j) { \
+			uint32_t t; \
+			t = rotl32(al + f((j), bl, cl, dl) + w[RL[(j)]] + KL[(j) / 16], SL[(j)]) + el; \
+			al = el; el = dl; dl = rotl32(cl, 10); cl = bl; bl = t; \
+			t = rotl32(ar + f(79 - (j), br, cr, dr) + w[RR[(j)]] + KR[(j) / 16], SR[(j)]) + er; \
+			ar = er; er = dr; dr = rotl32(cr, 10); cr = br; br = t; \
+		}
+#define STEP4(j) STEP(j) STEP(j + 1) STEP(j + 2) STEP(j + 3)
+#define STEP16(j) STEP4(j) STEP4(j + 4) STEP4(j + 8) STEP4(j + 12)
+
+		STEP16(0) STEP16(16) STEP16(32) STEP16(48) STEP16(64)
+
+#undef STEP16
+#undef STEP4
+#undef STEP
+
+		uint32_t t = s[1] + cl + dr;
+		s[1] = s[2] + dl + er;
+		s[2] = s[3] + el + ar;
+		s[3] = s[4] + al + br;
+		s[4] = s[0] + bl + cr;
+		s[0] = t;
+	}
+}
+
+} // namespace internal
+
+void ripemd160_init(ripemd160_ctx_t* ctx) {
+	std::memcpy(ctx->state, ripemd160_initial_state, sizeof(ctx->state));
+	ctx->count = 0;
+}
+
+void ripemd160_update(ripemd160_ctx_t* ctx, const unsigned char *data, std::size_t len) {
+
+	std::size_t used = ctx->count % 64;
+
+	ctx->count += len;
+
+	// Fill up a partial block first.
+	if (used) {
+		std::size_t n = 64 - used < len ? 64 - used : len;
+		std::memcpy(ctx->buf + used, data, n);
+		data += n;
+		len -= n;
+		if (used + n < 64) {
+			return;
+		}
+		ripemd160_transform(ctx->state, ctx->buf, 1);
+	}
+
+	ripemd160_transform(ctx->state, data, len / 64);
+	std::memcpy(ctx->buf, data + (len & ~(std::size_t) 63), len % 64);
+}
+
+ripemd160_t* ripemd160_final(ripemd160_ctx_t* ctx, ripemd160_t* out) {
+
+	static const unsigned char pad[64] = { 0x80 };
+	unsigned char len[8];
+
+	write_le64(len, ctx->count << 3);
+	ripemd160_update(ctx, pad, 1 + ((119 - (ctx->count % 64)) % 64));
+	ripemd160_update(ctx, len, sizeof(len));
+
+	for (int i = 0; i < 5; i++) {
+		write_le32(*out + i * 4, ctx->state[i]);
+	}
+	return out;
+}
+
+} // namespace libeosio
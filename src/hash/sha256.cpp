@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <libeosio/hash.hpp>
+#include "../cpu.hpp"
+#include "common.hpp"
+#include "transform.hpp"
+
+namespace libeosio {
+
+namespace internal {
+
+const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+const uint32_t sha256_initial_state[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static inline uint32_t Ch(uint32_t x, uint32_t y, uint32_t z) { return z ^ (x & (y ^ z)); }
+static inline uint32_t Maj(uint32_t x, uint32_t y, uint32_t z) { return (x & y) | (z & (x | y)); }
+static inline uint32_t Sigma0(uint32_t x) { return rotr32(x, 2) ^ rotr32(x, 13) ^ rotr32(x, 22); }
+static inline uint32_t Sigma1(uint32_t x) { return rotr32(x, 6) ^ rotr32(x, 11) ^ rotr32(x, 25); }
+static inline uint32_t sigma0(uint32_t x) { return rotr32(x, 7) ^ rotr32(x, 18) ^ (x >> 3); }
+static inline uint32_t sigma1(uint32_t x) { return rotr32(x, 17) ^ rotr32(x, 19) ^ (x >> 10); }
+
+void sha256_transform_generic(uint32_t *state, const unsigned char *data, std::size_t blocks) {
+
+	uint32_t w[64];
+
+	for (; blocks > 0; blocks--, data += 64) {
+		uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+		uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+		for (int i = 0; i < 16; i++) {
+			w[i] = read_be32(data + i * 4);
+		}
+		for (int i = 16; i < 64; i++) {
+			w[i] = sigma1(w[i - 2]) + w[i - 7] + sigma0(w[i - 15]) + w[i - 16];
+		}
+
+		// Fully unrolled, the register rotation is then resolved at compile time.
+#define ROUND(i) { \
+			uint32_t t1 = h + Sigma1(e) + Ch(e, f, g) + sha256_k[(i)] + w[(i)]; \
+			uint32_t t2 = Sigma0(a) + Maj(a, b, c); \
+			h = g; g = f; f = e; e = d + t1; \
+			d = c; c = b; b = a; a = t1 + t2; \
+		}
+#define ROUND4(i) ROUND(i) ROUND(i + 1) ROUND(i + 2) ROUND(i + 3)
+#define ROUND16(i) ROUND4(i) ROUND4(i + 4) ROUND4(i + 8) ROUND4(i + 12)
+
+		ROUND16(0) ROUND16(16) ROUND16(32) ROUND16(48)
+
+#undef ROUND16
+#undef ROUND4
+#undef ROUND
+
+		state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+		state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+	}
+}
+
+static sha256_transform_t _select() {
+#if defined(LIBEOSIO_SIMD_X86)
+	const cpu_features& cpu = cpu_get_features();
+
+	if (cpu.sha) {
+		return sha256_transform_shani;
+	}
+#endif
+	return sha256_transform_generic;
+}
+
+void sha256_transform(uint32_t *state, const unsigned char *data, std::size_t blocks) {
+	static const sha256_transform_t kernel = _select();
+	kernel(state, data, blocks);
+}
+
+} // namespace internal
+
+using namespace internal;
+
+void sha256_init(sha256_ctx_t* ctx) {
+	std::memcpy(ctx->state, sha256_initial_state, sizeof(ctx->state));
+	ctx->count = 0;
+}
+
+void sha256_update(sha256_ctx_t* ctx, const unsigned char *data, std::size_t len) {
+
+	std::size_t used = ctx->count % 64;
+
+	ctx->count += len;
+
+	// Fill up a partial block first.
+	if (used) {
+		std::size_t n = 64 - used < len ? 64 - used : len;
+		std::memcpy(ctx->buf + used, data, n);
+		data += n;
+		len -= n;
+		if (used + n < 64) {
+			return;
+		}
+		sha256_transform(ctx->state, ctx->buf, 1);
+	}
+
+	if (len >= 64) {
+		sha256_transform(ctx->state, data, len / 64);
+	}
+	std::memcpy(ctx->buf, data + (len & ~(std::size_t) 63), len % 64);
+}
+
+sha256_t* sha256_final(sha256_ctx_t* ctx, sha256_t* out) {
+
+	static const unsigned char pad[64] = { 0x80 };
+	unsigned char len[8];
+
+	write_be64(len, ctx->count << 3);
+	sha256_update(ctx, pad, 1 + ((119 - (ctx->count % 64)) % 64));
+	sha256_update(ctx, len, sizeof(len));
+
+	for (int i = 0; i < 8; i++) {
+		write_be32(*out + i * 4, ctx->state[i]);
+	}
+	return out;
+}
+
+} // namespace libeosio
@@ -0,0 +1,87 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <immintrin.h>
+#include "transform.hpp"
+
+namespace libeosio { namespace internal {
+
+// Four rounds, `m0` holds the message words for these rounds.
+// Also advances the message schedule (`m1` and `m3`) while the rounds are computed.
+#define QUAD(i, m0, m1, m3) { \
+		msg = _mm_add_epi32(m0, _mm_loadu_si128((const __m128i*) &sha256_k[4 * (i)])); \
+		state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+		if ((i) >= 3 && (i) <= 14) { \
+			m1 = _mm_sha256msg2_epu32(_mm_add_epi32(m1, _mm_alignr_epi8(m0, m3, 4)), m0); \
+		} \
+		msg = _mm_shuffle_epi32(msg, 0x0e); \
+		state0 = _mm_sha256rnds2_epu32(state0, state1, msg); \
+		if ((i) >= 1 && (i) <= 12) { \
+			m3 = _mm_sha256msg1_epu32(m3, m0); \
+		} \
+	}
+
+void sha256_transform_shani(uint32_t *state, const unsigned char *data, std::size_t blocks) {
+
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, msg, tmp;
+	__m128i m0, m1, m2, m3;
+
+	// The sha instructions wants the state as ABEF and CDGH.
+	tmp = _mm_loadu_si128((const __m128i*) &state[0]);
+	state1 = _mm_loadu_si128((const __m128i*) &state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xb1);
+	state1 = _mm_shuffle_epi32(state1, 0x1b);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+	for (; blocks > 0; blocks--, data += 64) {
+		const __m128i abef = state0, cdgh = state1;
+
+		m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 0)), mask);
+		m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 16)), mask);
+		m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 32)), mask);
+		m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (data + 48)), mask);
+
+		QUAD(0, m0, m1, m3) QUAD(1, m1, m2, m0) QUAD(2, m2, m3, m1) QUAD(3, m3, m0, m2)
+		QUAD(4, m0, m1, m3) QUAD(5, m1, m2, m0) QUAD(6, m2, m3, m1) QUAD(7, m3, m0, m2)
+		QUAD(8, m0, m1, m3) QUAD(9, m1, m2, m0) QUAD(10, m2, m3, m1) QUAD(11, m3, m0, m2)
+		QUAD(12, m0, m1, m3) QUAD(13, m1, m2, m0) QUAD(14, m2, m3, m1) QUAD(15, m3, m0, m2)
+
+		state0 = _mm_add_epi32(state0, abef);
+		state1 = _mm_add_epi32(state1, cdgh);
+	}
+
+	// Back to ABCD and EFGH.
+	tmp = _mm_shuffle_epi32(state0, 0x1b);
+	state1 = _mm_shuffle_epi32(state1, 0xb1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+	_mm_storeu_si128((__m128i*) &state[0], state0);
+	_mm_storeu_si128((__m128i*) &state[4], state1);
+}
+
+#undef QUAD
+
+}} // namespace libeosio::internal
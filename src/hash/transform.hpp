@@ -0,0 +1,78 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_HASH_TRANSFORM_H
+#define LIBEOSIO_HASH_TRANSFORM_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Compression functions
+ *
+ * Process `blocks` already padded 64 byte blocks from `data` into `state`.
+ * Used by code that builds its own message blocks instead of going through a context.
+ */
+extern const uint32_t sha256_k[64];
+extern const uint32_t sha256_initial_state[8];
+extern const uint32_t ripemd160_initial_state[5];
+
+void sha256_transform(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+/**
+ * SHA-256 kernels, sha256_transform() picks the best one for the running cpu.
+ *
+ * A single message is a serial dependency chain, so vector instructions only help when
+ * several messages are hashed at once.
+ */
+typedef void (*sha256_transform_t)(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+void sha256_transform_generic(uint32_t *state, const unsigned char *data, std::size_t blocks);
+void sha256_transform_shani(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+void ripemd160_transform(uint32_t *state, const unsigned char *data, std::size_t blocks);
+
+/**
+ * Multi-buffer kernels
+ *
+ * Compress one 64 byte block for each of `lanes` independent messages. `state` holds
+ * the hash words row by row (word `i` of lane `k` is `state[i * lanes + k]`) and
+ * `blocks[k]` points to the block of lane `k`.
+ */
+#define HASH_BATCH_MAX_LANES 16
+
+typedef void (*hash_batch_kernel_t)(uint32_t *state, const unsigned char *const *blocks);
+
+void sha256_batch_sse41(uint32_t *state, const unsigned char *const *blocks);      // 4 lanes
+void sha256_batch_avx2(uint32_t *state, const unsigned char *const *blocks);       // 8 lanes
+void sha256_batch_avx512(uint32_t *state, const unsigned char *const *blocks);     // 16 lanes
+
+void ripemd160_batch_sse41(uint32_t *state, const unsigned char *const *blocks);   // 4 lanes
+void ripemd160_batch_avx2(uint32_t *state, const unsigned char *const *blocks);    // 8 lanes
+void ripemd160_batch_avx512(uint32_t *state, const unsigned char *const *blocks);  // 16 lanes
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_HASH_TRANSFORM_H */
@@ -0,0 +1,211 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cstring>
+#include <libeosio/WIF.hpp>
+#include <libeosio/keyfile.hpp>
+#include "file_map.hpp"
+#include "parallel.hpp"
+
+namespace libeosio {
+
+// Smallest amount of input worth giving a thread of its own.
+#define KEYFILE_MIN_CHUNK (64 * 1024)
+
+namespace {
+
+// Part of the input processed by one worker. Always starts at the beginning of a line.
+struct chunk {
+	const char* begin;
+	const char* end;
+	// Index of the first line and number of lines in the chunk.
+	std::size_t first;
+	std::size_t count;
+	// Status words shared with the neighbour chunks, merged after all workers are done.
+	std::size_t num_shared;
+	std::size_t shared_word[2];
+	uint64_t shared_bits[2];
+};
+
+} // namespace
+
+// Split `data` into `n` chunks on line boundaries.
+static void _split(const char* data, std::size_t size, std::vector<chunk>& chunks, std::size_t n) {
+
+	const char* end = data + size;
+
+	chunks.resize(n);
+	for (std::size_t i = 0; i < n; i++) {
+		const char* p = data + size / n * i;
+
+		// Move forward to the start of the next line.
+		if (i > 0) {
+			p = std::max(p, chunks[i - 1].begin);
+			const char* nl = static_cast<const char*>(std::memchr(p - 1, '\n', end - p + 1));
+			p = nl ? nl + 1 : end;
+		}
+
+		chunks[i].begin = p;
+		chunks[i].num_shared = 0;
+	}
+
+	for (std::size_t i = 0; i + 1 < n; i++) {
+		chunks[i].end = chunks[i + 1].begin;
+	}
+	chunks[n - 1].end = end;
+}
+
+static std::size_t _count_lines(const char* begin, const char* end, bool last) {
+
+	std::size_t count = std::count(begin, end, '\n');
+
+	// Last line is not terminated.
+	if (last && begin < end && end[-1] != '\n') {
+		count++;
+	}
+	return count;
+}
+
+static void _store_status(chunk& c, wif_status_t& status, std::size_t word, uint64_t bits) {
+
+	// Words that contain lines from other chunks are merged later.
+	if (word * 64 < c.first || (word + 1) * 64 > c.first + c.count) {
+		c.shared_word[c.num_shared] = word;
+		c.shared_bits[c.num_shared] = bits;
+		c.num_shared++;
+	} else {
+		status[word] = bits;
+	}
+}
+
+template <typename T, bool (*Decode)(T&, const char*, std::size_t)>
+static void _decode_chunk(chunk& c, T* out, wif_status_t& status) {
+
+	const char* p = c.begin;
+	std::size_t line = c.first;
+	std::size_t word = line / 64;
+	uint64_t bits = 0;
+
+	while (p < c.end) {
+		const char* nl = static_cast<const char*>(std::memchr(p, '\n', c.end - p));
+		const char* e = nl ? nl : c.end;
+		std::size_t len = e - p;
+
+		if (len > 0 && p[len - 1] == '\r') {
+			len--;
+		}
+
+		if (line / 64 != word) {
+			_store_status(c, status, word, bits);
+			word = line / 64;
+			bits = 0;
+		}
+
+		if (Decode(out[line], p, len)) {
+			bits |= (uint64_t) 1 << (line % 64);
+		} else {
+			std::memset(out[line].data(), 0, out[line].size());
+		}
+
+		line++;
+		p = e + 1;
+	}
+
+	if (c.count > 0) {
+		_store_status(c, status, word, bits);
+	}
+}
+
+template <typename T, bool (*Decode)(T&, const char*, std::size_t)>
+static void _decode_lines(const char* data, std::size_t size, std::vector<T>& out,
+	wif_status_t& status, unsigned int threads) {
+
+	std::vector<chunk> chunks;
+	std::size_t n = std::min<std::size_t>(internal::parallel_threads(threads), size / KEYFILE_MIN_CHUNK + 1);
+	std::size_t total = 0;
+
+	_split(data, size, chunks, n);
+
+	// First pass: count lines so every chunk knows where its output starts.
+	internal::parallel_for(n, [&](std::size_t i) {
+		chunks[i].count = _count_lines(chunks[i].begin, chunks[i].end, i + 1 == n);
+	});
+
+	for (std::size_t i = 0; i < n; i++) {
+		chunks[i].first = total;
+		total += chunks[i].count;
+	}
+
+	out.resize(total);
+	status.assign((total + 63) / 64, 0);
+
+	// Second pass: decode.
+	internal::parallel_for(n, [&](std::size_t i) {
+		_decode_chunk<T, Decode>(chunks[i], out.data(), status);
+	});
+
+	for (std::size_t i = 0; i < n; i++) {
+		for (std::size_t j = 0; j < chunks[i].num_shared; j++) {
+			status[chunks[i].shared_word[j]] |= chunks[i].shared_bits[j];
+		}
+	}
+}
+
+void wif_pub_decode_lines(const char* data, std::size_t size, std::vector<ec_pubkey_t>& keys,
+	wif_status_t& status, unsigned int threads) {
+	_decode_lines<ec_pubkey_t, wif_pub_decode>(data, size, keys, status, threads);
+}
+
+void wif_sig_decode_lines(const char* data, std::size_t size, std::vector<ec_signature_t>& sigs,
+	wif_status_t& status, unsigned int threads) {
+	_decode_lines<ec_signature_t, wif_sig_decode>(data, size, sigs, status, threads);
+}
+
+int wif_pub_decode_file(const std::string& filename, std::vector<ec_pubkey_t>& keys,
+	wif_status_t& status, unsigned int threads) {
+
+	internal::file_map file;
+
+	if (file.open(filename) < 0) {
+		return -1;
+	}
+
+	wif_pub_decode_lines(file.data(), file.size(), keys, status, threads);
+	return 0;
+}
+
+int wif_sig_decode_file(const std::string& filename, std::vector<ec_signature_t>& sigs,
+	wif_status_t& status, unsigned int threads) {
+
+	internal::file_map file;
+
+	if (file.open(filename) < 0) {
+		return -1;
+	}
+
+	wif_sig_decode_lines(file.data(), file.size(), sigs, status, threads);
+	return 0;
+}
+
+} // namespace libeosio
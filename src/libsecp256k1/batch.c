@@ -0,0 +1,224 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * A signature (r, s) with recovery id v is valid when R == z/s * G + r/s * P, where z is
+ * the digest, P the public key and R the point with x coordinate r (+ n if v & 2) and y
+ * parity v & 1. Plain verification only knows the x coordinate of R and has to compute
+ * the right hand side on its own, one double scalar multiplication per signature. With
+ * R known the equations of a whole batch can be summed up with random weights a_i,
+ *
+ *   sum(a_i * R_i) - sum(a_i * r_i/s_i * P_i) - sum(a_i * z_i/s_i) * G == 0,
+ *
+ * which is one multi scalar multiplication (Strauss or Pippenger) that shares its
+ * doublings between all the points. The a_i are 128 bits, without knowing them an
+ * invalid signature only cancels out with probability 2^-128, and the terms of
+ * signatures by the same public key add up to a single point.
+ *
+ * The check is stricter than secp256k1_ecdsa_verify() as it also requires the recovery
+ * id to be right, callers verify the signatures one by one when a batch fails.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "internal.h"
+#include "ecmult_impl.h"
+#include "scratch_impl.h"
+#include "batch.h"
+
+// Report failures through return values, the default callback of libsecp256k1 aborts.
+static void _ignore_error(const char *str, void *data) {
+	(void) str;
+	(void) data;
+}
+
+static const secp256k1_callback _error_callback = { _ignore_error, NULL };
+
+struct _batch {
+	secp256k1_scalar *sc;
+	secp256k1_ge *pt;
+};
+
+static int _batch_point(secp256k1_scalar *sc, secp256k1_ge *pt, size_t idx, void *data) {
+
+	const struct _batch *b = (const struct _batch *) data;
+
+	*sc = b->sc[idx];
+	*pt = b->pt[idx];
+	return 1;
+}
+
+// The signature scalars and R, the point with x coordinate r (+ n) picked by the recovery id.
+static int _parse_signature(secp256k1_scalar *r, secp256k1_scalar *s, secp256k1_ge *R, const unsigned char *sig) {
+
+	secp256k1_fe x;
+	int recid = _parse_rs(r, s, sig);
+
+	if (recid < 0) {
+		return 0;
+	}
+
+	// r < n < p, so it is a field element as well.
+	secp256k1_fe_set_b32(&x, sig + 1);
+	if (recid & 2) {
+		if (secp256k1_fe_cmp_var(&x, &_p_minus_order) >= 0) {
+			return 0;
+		}
+		secp256k1_fe_add(&x, &_order_as_fe);
+	}
+
+	return secp256k1_ge_set_xo_var(R, &x, recid & 1);
+}
+
+static size_t _scratch_size(size_t points) {
+
+	size_t strauss = secp256k1_strauss_scratch_size(points) + STRAUSS_SCRATCH_OBJECTS * ALIGNMENT;
+	size_t pippenger = secp256k1_pippenger_scratch_size(points, secp256k1_pippenger_bucket_window(points))
+		+ PIPPENGER_SCRATCH_OBJECTS * ALIGNMENT;
+
+	return points < ECMULT_PIPPENGER_THRESHOLD && strauss > pippenger ? strauss : pippenger;
+}
+
+// Public keys sorted by their encoding, so signatures by the same key share one point.
+struct _key {
+	const unsigned char *key;
+	size_t i;
+};
+
+static int _key_cmp(const void *a, const void *b) {
+
+	const struct _key *ka = (const struct _key *) a;
+	const struct _key *kb = (const struct _key *) b;
+	int c = memcmp(ka->key, kb->key, 33);
+
+	return c != 0 ? c : (ka->i > kb->i) - (ka->i < kb->i);
+}
+
+int batch_verify(const unsigned char *digests, const unsigned char *sigs, const unsigned char *keys,
+	const unsigned char *rand, size_t count) {
+
+	struct _batch b;
+	struct _key *order = NULL;
+	secp256k1_scratch *scratch = NULL;
+	secp256k1_scalar *w = NULL;
+	secp256k1_scalar g, a, r, s, z, inv;
+	secp256k1_gej sum;
+	unsigned char a32[32];
+	size_t i, m;
+	int ret = 0;
+
+	if (count == 0) {
+		return 1;
+	}
+
+	b.sc = (secp256k1_scalar *) malloc(2 * count * sizeof(secp256k1_scalar));
+	b.pt = (secp256k1_ge *) malloc(2 * count * sizeof(secp256k1_ge));
+	w = (secp256k1_scalar *) malloc(count * sizeof(secp256k1_scalar));
+	order = (struct _key *) malloc(count * sizeof(struct _key));
+	if (b.sc == NULL || b.pt == NULL || w == NULL || order == NULL) {
+		goto out;
+	}
+
+	// Points 0 .. count - 1 are the R_i, the distinct public keys follow. Until the
+	// public keys are known b.sc[count + i] holds r_i and b.sc[i] the product s_0 ... s_i.
+	for (i = 0; i < count; i++) {
+
+		if (!_parse_signature(&b.sc[count + i], &w[i], &b.pt[i], sigs + i * 65)) {
+			goto out;
+		}
+
+		b.sc[i] = w[i];
+		if (i > 0) {
+			secp256k1_scalar_mul(&b.sc[i], &b.sc[i - 1], &w[i]);
+		}
+
+		order[i].key = keys + i * 33;
+		order[i].i = i;
+	}
+
+	// Montgomery's trick: w_i = 1 / s_i with a single inversion.
+	secp256k1_scalar_inverse_var(&inv, &b.sc[count - 1]);
+	for (i = count - 1; i > 0; i--) {
+		s = w[i];
+		secp256k1_scalar_mul(&w[i], &inv, &b.sc[i - 1]);
+		secp256k1_scalar_mul(&inv, &inv, &s);
+	}
+	w[0] = inv;
+
+	// The equations divided by s_i, R_i = z_i / s_i * G + r_i / s_i * P_i, so the
+	// weights of the R_i stay 128 bits and need half the point additions.
+	secp256k1_scalar_clear(&g);
+	memset(a32, 0, sizeof(a32));
+	for (i = 0; i < count; i++) {
+
+		memcpy(a32 + 32 - BATCH_RANDOM_SIZE, rand + i * BATCH_RANDOM_SIZE, BATCH_RANDOM_SIZE);
+		secp256k1_scalar_set_b32(&a, a32, NULL);
+		secp256k1_scalar_mul(&w[i], &w[i], &a);
+
+		secp256k1_scalar_set_b32(&z, digests + i * 32, NULL);
+		secp256k1_scalar_mul(&z, &z, &w[i]);
+		secp256k1_scalar_add(&g, &g, &z);
+
+		b.sc[i] = a;
+	}
+	secp256k1_scalar_negate(&g, &g);
+
+	// Sum up the weights of each public key, w_i becomes -a_i * r_i / s_i.
+	for (i = 0; i < count; i++) {
+		secp256k1_scalar_mul(&r, &b.sc[count + i], &w[i]);
+		secp256k1_scalar_negate(&w[i], &r);
+	}
+
+	qsort(order, count, sizeof(struct _key), _key_cmp);
+	for (i = 0, m = count; i < count; i++) {
+		if (i > 0 && memcmp(order[i].key, order[i - 1].key, 33) == 0) {
+			secp256k1_scalar_add(&b.sc[m - 1], &b.sc[m - 1], &w[order[i].i]);
+			continue;
+		}
+		if (!_parse_compressed(&b.pt[m], order[i].key)) {
+			goto out;
+		}
+		b.sc[m++] = w[order[i].i];
+	}
+
+	scratch = secp256k1_scratch_create(&_error_callback, _scratch_size(m));
+	if (scratch == NULL) {
+		goto out;
+	}
+
+	if (secp256k1_ecmult_multi_var(&_error_callback, scratch, &sum, &g, _batch_point, &b, m)) {
+		ret = secp256k1_gej_is_infinity(&sum);
+	}
+
+out:
+	memset(a32, 0, sizeof(a32));
+	secp256k1_scalar_clear(&a);
+	if (scratch != NULL) {
+		secp256k1_scratch_destroy(&_error_callback, scratch);
+	}
+	free(b.sc);
+	free(b.pt);
+	free(w);
+	free(order);
+	return ret;
+}
@@ -0,0 +1,55 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_BATCH_H
+#define LIBEOSIO_LIBSECP256K1_BATCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Bytes of randomness batch_verify() needs per signature.
+ */
+#define BATCH_RANDOM_SIZE 16
+
+/**
+ * Check that all `count` signatures are valid with a single multi scalar multiplication.
+ *
+ * Signature i is the 65 byte eosio signature at `sigs + i * 65` (27 + 4 + recovery id,
+ * r, s) of the 32 byte digest at `digests + i * 32` by the compressed public key at
+ * `keys + i * 33`. `rand` holds count * BATCH_RANDOM_SIZE secret random bytes.
+ *
+ * returns 1 if every signature is valid. 0 if at least one is not (with overwhelming
+ * probability), a signature or key can not be parsed or memory could not be allocated.
+ */
+int batch_verify(const unsigned char *digests, const unsigned char *sigs, const unsigned char *keys,
+	const unsigned char *rand, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEOSIO_LIBSECP256K1_BATCH_H */
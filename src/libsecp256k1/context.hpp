@@ -0,0 +1,55 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_CONTEXT_H
+#define LIBEOSIO_LIBSECP256K1_CONTEXT_H
+
+#include <cstddef>
+#include <secp256k1.h>
+#include <libeosio/ec.hpp>
+
+namespace libeosio { namespace internal { namespace libsecp256k1 {
+
+struct context {
+	secp256k1_context *ctx;
+	std::size_t randomize_interval;
+	std::size_t keys; // Generated since the last randomization.
+};
+
+// Functions of the backend table defined in ecdsa.cpp.
+int sign(void *state, const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig);
+int verify(void *state, const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key);
+int verify_batch(void *state, const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid);
+int verify_prepared(void *state, const sha256_t* digest, const ec_signature_t& sig, const void *key);
+int recover(void *state, const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key);
+
+void* signer_new(void *state, const ec_privkey_t& key);
+void signer_free(void *signer);
+int signer_sign(void *state, void *signer, const sha256_t* digest, ec_signature_t& sig);
+
+void* prepared_new(const ec_pubkey_t& key, bool precompute);
+void prepared_free(void *key);
+
+}}} // namespace libeosio::internal::libsecp256k1
+
+#endif /* LIBEOSIO_LIBSECP256K1_CONTEXT_H */
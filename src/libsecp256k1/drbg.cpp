@@ -0,0 +1,167 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <atomic>
+#include <cstring>
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+#include "../hash/common.hpp"
+#include "drbg.hpp"
+#include "rng.h"
+
+namespace libeosio { namespace internal {
+
+namespace {
+
+// Bumped in the child after every fork, so the generators there reseed instead of
+// repeating the output of the parent.
+std::atomic<unsigned> fork_generation(0);
+
+#if !defined(_WIN32)
+void _on_fork() {
+	fork_generation++;
+}
+#endif
+
+bool _register_fork_handler() {
+#if !defined(_WIN32)
+	return pthread_atfork(NULL, NULL, _on_fork) == 0;
+#else
+	return true;
+#endif
+}
+
+} // namespace
+
+#define QUARTERROUND(a, b, c, d) \
+	a += b; d ^= a; d = rotl32(d, 16); \
+	c += d; b ^= c; b = rotl32(b, 12); \
+	a += b; d ^= a; d = rotl32(d, 8); \
+	c += d; b ^= c; b = rotl32(b, 7);
+
+void chacha20_block(const uint32_t *key, uint64_t counter, uint64_t nonce, unsigned char *out) {
+
+	uint32_t in[16] = {
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+		key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+		(uint32_t) counter, (uint32_t) (counter >> 32), (uint32_t) nonce, (uint32_t) (nonce >> 32)
+	};
+	uint32_t x[16];
+
+	std::memcpy(x, in, sizeof(x));
+	for (int i = 0; i < 10; i++) {
+		QUARTERROUND(x[0], x[4], x[8], x[12]);
+		QUARTERROUND(x[1], x[5], x[9], x[13]);
+		QUARTERROUND(x[2], x[6], x[10], x[14]);
+		QUARTERROUND(x[3], x[7], x[11], x[15]);
+		QUARTERROUND(x[0], x[5], x[10], x[15]);
+		QUARTERROUND(x[1], x[6], x[11], x[12]);
+		QUARTERROUND(x[2], x[7], x[8], x[13]);
+		QUARTERROUND(x[3], x[4], x[9], x[14]);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		write_le32(out + i * 4, x[i] + in[i]);
+	}
+}
+
+#undef QUARTERROUND
+
+chacha20_drbg::chacha20_drbg(drbg_seed_t seed) : seed(seed), pos(sizeof(buf)), output(0), generation(0), seeded(false) {
+	std::memset(key, 0, sizeof(key));
+	std::memset(buf, 0, sizeof(buf));
+}
+
+chacha20_drbg::~chacha20_drbg() {
+	std::memset(key, 0, sizeof(key));
+	std::memset(buf, 0, sizeof(buf));
+}
+
+// Mix fresh entropy into the key and drop everything buffered with the old one.
+bool chacha20_drbg::_reseed() {
+
+	static const bool registered = _register_fork_handler();
+	unsigned char entropy[32];
+
+	if (!registered || !(seed ? seed(entropy, sizeof(entropy)) : fill_random(entropy, sizeof(entropy)))) {
+		return false;
+	}
+
+	for (int i = 0; i < 8; i++) {
+		key[i] ^= read_le32(entropy + i * 4);
+	}
+	std::memset(entropy, 0, sizeof(entropy));
+
+	output = 0;
+	generation = fork_generation;
+	seeded = true;
+	_refill();
+	return true;
+}
+
+void chacha20_drbg::_refill() {
+
+	for (int i = 0; i < DRBG_BLOCKS; i++) {
+		chacha20_block(key, i, 0, buf + i * 64);
+	}
+
+	// The key is only ever used for one batch, the next key comes from the batch itself.
+	for (int i = 0; i < 8; i++) {
+		key[i] = read_le32(buf + i * 4);
+	}
+	std::memset(buf, 0, 32);
+	pos = 32;
+}
+
+bool chacha20_drbg::fill(unsigned char *out, std::size_t len) {
+
+	if (!seeded || generation != fork_generation || output >= DRBG_RESEED_BYTES) {
+		if (!_reseed()) {
+			return false;
+		}
+	}
+
+	output += len;
+	while (len) {
+		if (pos == sizeof(buf)) {
+			_refill();
+		}
+
+		std::size_t n = len < sizeof(buf) - pos ? len : sizeof(buf) - pos;
+		std::memcpy(out, buf + pos, n);
+		std::memset(buf + pos, 0, n);
+		pos += n;
+		out += n;
+		len -= n;
+	}
+
+	return true;
+}
+
+bool drbg_fill(unsigned char *out, std::size_t len) {
+	static thread_local chacha20_drbg drbg;
+	return drbg.fill(out, len);
+}
+
+}} // namespace libeosio::internal
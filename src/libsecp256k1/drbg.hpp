@@ -0,0 +1,97 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_DRBG_H
+#define LIBEOSIO_LIBSECP256K1_DRBG_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Reseed after this many bytes of output.
+ */
+#define DRBG_RESEED_BYTES (1024 * 1024)
+
+/**
+ * Keystream blocks generated at once, the first 32 bytes of every batch become the next key.
+ */
+#define DRBG_BLOCKS 16
+
+/**
+ * One 64 byte ChaCha20 keystream block. `counter` and `nonce` fill the last four
+ * state words, 64 bits each (low word first), as in the original ChaCha.
+ */
+void chacha20_block(const uint32_t *key, uint64_t counter, uint64_t nonce, unsigned char *out);
+
+/**
+ * Seed source of a generator, fills `len` bytes at `out`. Returns false on failure.
+ */
+typedef bool (*drbg_seed_t)(unsigned char *out, std::size_t len);
+
+/**
+ * ChaCha20 based random bit generator.
+ *
+ * Serves random bytes from an in-process buffer instead of asking the OS for every
+ * key. Seeded from the OS (fill_random), or `seed` if given, on first use, reseeded
+ * after DRBG_RESEED_BYTES and in the child after a fork.
+ *
+ * Uses fast key erasure: every refill replaces the key with fresh keystream, and bytes
+ * are wiped from the buffer once handed out, so a later compromise of the state does
+ * not reveal earlier output.
+ */
+class chacha20_drbg {
+public:
+	explicit chacha20_drbg(drbg_seed_t seed = NULL);
+	~chacha20_drbg();
+
+	chacha20_drbg(const chacha20_drbg&) = delete;
+	chacha20_drbg& operator=(const chacha20_drbg&) = delete;
+
+	/**
+	 * Fill `len` bytes at `out`. Returns false if the generator could not be seeded.
+	 */
+	bool fill(unsigned char *out, std::size_t len);
+
+private:
+	bool _reseed();
+	void _refill();
+
+	drbg_seed_t seed;
+	uint32_t key[8];
+	unsigned char buf[DRBG_BLOCKS * 64];
+	std::size_t pos;       // Next unused byte in `buf`.
+	std::size_t output;    // Bytes since the last reseed.
+	unsigned generation;   // Fork generation the state belongs to.
+	bool seeded;
+};
+
+/**
+ * Fill `len` bytes at `out` from the generator of the calling thread.
+ */
+bool drbg_fill(unsigned char *out, std::size_t len);
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_LIBSECP256K1_DRBG_H */
@@ -24,38 +24,71 @@
 #include <secp256k1.h>
 #include <secp256k1_ecdh.h>
 #include <libeosio/ec.hpp>
-#include "rng.h"
+#include "../ec_backend.hpp"
+#include "context.hpp"
+#include "drbg.hpp"
+#include "sequential.h"
+#include <cstring>
 
-namespace libeosio {
+namespace libeosio { namespace internal { namespace libsecp256k1 {
 
-secp256k1_context* ctx;
+// Renew the blinding of the context with fresh random bytes.
+static bool _randomize(secp256k1_context *ctx) {
 
-int ec_init() {
-	ctx = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
-	return ctx == NULL ? -1 : 0;
-}
+	unsigned char seed[32];
 
-void ec_shutdown() {
-	if (ctx) {
-		secp256k1_context_destroy(ctx);
-		ctx = NULL;
+	if (!internal::drbg_fill(seed, sizeof(seed))) {
+		return false;
 	}
+
+	return secp256k1_context_randomize(ctx, seed) == 1;
 }
 
-int ec_generate_privkey(ec_privkey_t *priv) {
+static void* context_new() {
 
-	unsigned char randomize[32];
+	context *p = new context();
 
-	if (!fill_random(randomize, sizeof(randomize))) {
-		return -1;
+	p->randomize_interval = EC_RANDOMIZE_INTERVAL;
+	p->keys = 0;
+	p->ctx = secp256k1_context_create(SECP256K1_CONTEXT_NONE);
+
+	if (p->ctx && !_randomize(p->ctx)) {
+		secp256k1_context_destroy(p->ctx);
+		p->ctx = NULL;
 	}
 
-	if (secp256k1_context_randomize(ctx, randomize) < 0) {
-		return -1;
+	if (!p->ctx) {
+		delete p;
+		return NULL;
+	}
+	return p;
+}
+
+static void context_free(void *state) {
+	context *p = (context*) state;
+
+	secp256k1_context_destroy(p->ctx);
+	delete p;
+}
+
+static void set_randomize_interval(void *state, std::size_t keys) {
+	((context*) state)->randomize_interval = keys;
+}
+
+static int generate_privkey(void *state, ec_privkey_t *priv) {
+
+	context *p = (context*) state;
+	secp256k1_context *ctx = p->ctx;
+
+	if (p->randomize_interval && ++p->keys >= p->randomize_interval) {
+		if (!_randomize(ctx)) {
+			return -1;
+		}
+		p->keys = 0;
 	}
 
 	while (1) {
-		if (!fill_random(priv->data(), priv->size())) {
+		if (!internal::drbg_fill(priv->data(), priv->size())) {
 			return -1;
 		}
 		if (secp256k1_ec_seckey_verify(ctx, priv->data())) {
@@ -66,8 +99,9 @@ int ec_generate_privkey(ec_privkey_t *priv) {
 	return 0;
 }
 
-int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
+static int get_publickey(void *state, const ec_privkey_t *priv, ec_pubkey_t* pub) {
 
+	secp256k1_context *ctx = ((context*) state)->ctx;
 	size_t len;
 	secp256k1_pubkey ec_pub;
 
@@ -81,13 +115,78 @@ int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
 	return len != EC_PUBKEY_SIZE ? -1 : 0;
 }
 
-int ec_generate_key(struct ec_keypair *pair) {
+static int generate_key(void *state, struct ec_keypair *pair) {
 
-	if (ec_generate_privkey(&pair->secret) < 0) {
+	if (generate_privkey(state, &pair->secret) < 0) {
 		return -1;
 	}
 
-	return ec_get_publickey(&pair->secret, &pair->pub);
+	return get_publickey(state, &pair->secret, &pair->pub);
+}
+
+static int derive_keys_sequential(void *state, const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count) {
+
+	secp256k1_context *ctx = ((context*) state)->ctx;
+	ec_privkey_t start = base;
+	ec_pubkey_t pub;
+	unsigned char tweak[32] = { 0 };
+	int rc = -1;
+
+	if (count == 0) {
+		return 0;
+	}
+
+	if (!secp256k1_ec_seckey_verify(ctx, start.data())) {
+		goto out;
+	}
+
+	// start = base + offset (mod n).
+	if (offset) {
+		for (int i = 0; i < 8; i++) {
+			tweak[31 - i] = (unsigned char) (offset >> (i * 8));
+		}
+		if (!secp256k1_ec_seckey_tweak_add(ctx, start.data(), tweak)) {
+			goto out;
+		}
+	}
+
+	// The first point is a regular (blinded) scalar multiplication.
+	if (get_publickey(state, &start, &pub) < 0) {
+		goto out;
+	}
+
+	if (sequential_keys(start.data(), pub.data(), count,
+		pairs->secret.data(), pairs->pub.data(), sizeof(struct ec_keypair))) {
+		rc = 0;
+	}
+
+out:
+	std::memset(start.data(), 0, start.size());
+	return rc;
 }
 
-} // namespace libeosio
+} // namespace libsecp256k1
+
+const ec_backend ec_backend_libsecp256k1 = {
+	EC_BACKEND_LIBSECP256K1,
+	"libsecp256k1",
+	libsecp256k1::context_new,
+	libsecp256k1::context_free,
+	libsecp256k1::set_randomize_interval,
+	libsecp256k1::generate_privkey,
+	libsecp256k1::get_publickey,
+	libsecp256k1::generate_key,
+	libsecp256k1::derive_keys_sequential,
+	libsecp256k1::sign,
+	libsecp256k1::verify,
+	libsecp256k1::verify_batch,
+	libsecp256k1::verify_prepared,
+	libsecp256k1::recover,
+	libsecp256k1::signer_new,
+	libsecp256k1::signer_free,
+	libsecp256k1::signer_sign,
+	libsecp256k1::prepared_new,
+	libsecp256k1::prepared_free,
+};
+
+}} // namespace libeosio::internal
@@ -21,14 +21,19 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <algorithm>
+#include <cstring>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <libeosio/ec.hpp>
+#include "context.hpp"
+#include "drbg.hpp"
+#include "batch.h"
+#include "prepared.h"
+#include "signer.h"
 #include "rng.h"
 
-namespace libeosio {
-
-extern secp256k1_context* ctx;
+namespace libeosio { namespace internal { namespace libsecp256k1 {
 
 int is_canonical(const unsigned char *d) {
 	return !(d[1] & 0x80)
@@ -43,14 +48,15 @@ static int extended_nonce_function( unsigned char *nonce32, const unsigned char
 	return secp256k1_nonce_function_rfc6979(nonce32, msg32, key32, algo16, nullptr, *(unsigned int*) data);
 }
 
-int ecdsa_sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
+// EOSIO only accepts canonical signatures, the nonce is changed until one is.
+static int _sign(secp256k1_context *ctx, const unsigned char *key, const sha256_t* digest, ec_signature_t& sig) {
 
 	for (unsigned int counter = 1; counter < 25; counter++) {
 
 		int v = 0;
 		secp256k1_ecdsa_recoverable_signature s;
 
-		if (!secp256k1_ecdsa_sign_recoverable(ctx, &s, (const unsigned char*) digest, key.data(), extended_nonce_function, &counter)) {
+		if (!secp256k1_ecdsa_sign_recoverable(ctx, &s, (const unsigned char*) digest, key, extended_nonce_function, &counter)) {
 			return -1;
 		}
 
@@ -65,8 +71,56 @@ int ecdsa_sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t&
 	return -1;
 }
 
-int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key) {
+int sign(void *state, const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
+	return _sign(((context*) state)->ctx, key.data(), digest, sig);
+}
+
+// A signer is the parsed private key with a generator context of its own.
+void* signer_new(void *state, const ec_privkey_t& key) {
+
+	unsigned char seed[32];
+	signer_key *signer;
+
+	(void) state;
+
+	if (!internal::drbg_fill(seed, sizeof(seed))) {
+		return NULL;
+	}
+
+	signer = signer_key_create(key.data(), seed);
+	std::memset(seed, 0, sizeof(seed));
+	return signer;
+}
+
+void signer_free(void *signer) {
+	signer_key_destroy((signer_key*) signer);
+}
+
+// Same nonces and canonical loop as _sign().
+int signer_sign(void *state, void *signer, const sha256_t* digest, ec_signature_t& sig) {
+
+	(void) state;
+
+	for (unsigned int counter = 1; counter < 25; counter++) {
+
+		int v = 0;
+
+		if (!signer_key_sign((const signer_key*) signer, (const unsigned char*) digest, counter, sig.data() + 1, &v)) {
+			return -1;
+		}
+
+		if (is_canonical(sig.data())) {
+			sig[0] = 27 + 4 + v;
+			return 0;
+		}
+	}
 
+	return -1;
+}
+
+int verify(void *state, const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key) {
+
+	secp256k1_context *ctx = ((context*) state)->ctx;
 	secp256k1_ecdsa_signature ec_sig;
 	secp256k1_ecdsa_recoverable_signature ec_rec_sig;
 	secp256k1_pubkey pubkey;
@@ -74,6 +128,11 @@ int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pub
 
 	recid = sig.at(0) - 27 - 4;
 
+	// Out of range is an illegal argument to libsecp256k1, which aborts.
+	if (recid < 0 || recid > 3) {
+		return -1;
+	}
+
 	// Parse signature
 	if (!secp256k1_ecdsa_recoverable_signature_parse_compact(ctx, &ec_rec_sig, sig.data() + 1, recid)) {
 		return -1;
@@ -89,8 +148,68 @@ int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pub
 	return secp256k1_ecdsa_verify(ctx, &ec_sig, (const unsigned char*) digest, &pubkey) > 0 ? 0 : -1;
 }
 
-int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& pubkey) {
+void* prepared_new(const ec_pubkey_t& key, bool precompute) {
+	return prepared_key_create(key.data(), precompute);
+}
+
+void prepared_free(void *key) {
+	prepared_key_destroy((prepared_key*) key);
+}
+
+int verify_prepared(void *state, const sha256_t* digest, const ec_signature_t& sig, const void *key) {
+	(void) state;
+	return prepared_key_verify((const prepared_key*) key, (const unsigned char*) digest, sig.data()) ? 0 : -1;
+}
+
+// Signatures per multi scalar multiplication. Larger batches gain little and a failed
+// batch is verified again one signature at a time.
+#define VERIFY_BATCH 256
+
+static_assert(sizeof(ec_signature_t) == 65 && sizeof(ec_pubkey_t) == 33 && sizeof(sha256_t) == 32,
+	"batch_verify() expects packed arrays");
+
+int verify_batch(void *state, const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid) {
+
+	unsigned char rand[VERIFY_BATCH * BATCH_RANDOM_SIZE];
+	std::size_t n, i, batch;
+	int ret = 0;
 
+	for (n = 0; n < count; n += batch) {
+
+		batch = count - n < VERIFY_BATCH ? count - n : VERIFY_BATCH;
+
+		if (internal::drbg_fill(rand, batch * BATCH_RANDOM_SIZE)
+			&& batch_verify((const unsigned char*) (digests + n), sigs[n].data(), keys[n].data(), rand, batch)) {
+			if (valid) {
+				std::fill(valid + n, valid + n + batch, true);
+			}
+			continue;
+		}
+
+		// Find the bad signatures, this also accepts a wrong recovery id like verify() does.
+		for (i = n; i < n + batch; i++) {
+			bool ok = verify(state, digests + i, sigs[i], keys[i]) == 0;
+			if (valid) {
+				valid[i] = ok;
+			}
+			if (!ok) {
+				ret = -1;
+				if (!valid) {
+					goto out;
+				}
+			}
+		}
+	}
+
+out:
+	// The weights must stay secret, they are all that keeps bad signatures from cancelling out.
+	std::fill(rand, rand + sizeof(rand), 0);
+	return ret;
+}
+
+int recover(void *state, const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& pubkey) {
+
+	secp256k1_context *ctx = ((context*) state)->ctx;
 	secp256k1_pubkey ec_pubkey;
 	secp256k1_ecdsa_recoverable_signature ec_sig;
 	size_t len = EC_PUBKEY_SIZE;
@@ -98,9 +217,13 @@ int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t
 
 	recid = sig.at(0) - 27 - 4;
 
+	// Out of range is an illegal argument to libsecp256k1, which aborts.
+	if (recid < 0 || recid > 3) {
+		return -1;
+	}
+
 	// Parse signature
 	if (!secp256k1_ecdsa_recoverable_signature_parse_compact(ctx, &ec_sig, sig.data() + 1, recid)) {
-		std::cout << "parse sig" << std::endl;
 		return -1;
 	}
 
@@ -115,4 +238,4 @@ int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t
 	return len != EC_PUBKEY_SIZE ? -1 : 0;
 }
 
-} // namespace libeosio
+}}} // namespace libeosio::internal::libsecp256k1
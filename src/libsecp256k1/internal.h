@@ -0,0 +1,96 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_INTERNAL_H
+#define LIBEOSIO_LIBSECP256K1_INTERNAL_H
+
+/*
+ * Uses the field and group arithmetic of libsecp256k1 directly, the public api only
+ * has full scalar multiplications. Everything in these headers is static, so each
+ * file including them gets its own copy and nothing clashes with the library object.
+ * Only for C files built with the libsecp256k1 source directory in the include path.
+ */
+#include <secp256k1.h>
+#include "assumptions.h"
+#include "util.h"
+#include "field_impl.h"
+#include "scalar_impl.h"
+#include "group_impl.h"
+#include "int128_impl.h"
+
+// Same encoding as secp256k1_ec_pubkey_parse() and secp256k1_ec_pubkey_serialize() with
+// SECP256K1_EC_COMPRESSED. eckey_impl.h is not used as it pulls in the ecmult code.
+SECP256K1_INLINE static int _parse_compressed(secp256k1_ge *ge, const unsigned char *pub) {
+
+	secp256k1_fe x;
+
+	if (pub[0] != SECP256K1_TAG_PUBKEY_EVEN && pub[0] != SECP256K1_TAG_PUBKEY_ODD) {
+		return 0;
+	}
+
+	return secp256k1_fe_set_b32(&x, pub + 1) && secp256k1_ge_set_xo_var(ge, &x, pub[0] == SECP256K1_TAG_PUBKEY_ODD);
+}
+
+SECP256K1_INLINE static void _serialize_compressed(secp256k1_ge *ge, unsigned char *pub) {
+
+	secp256k1_fe_normalize_var(&ge->x);
+	secp256k1_fe_normalize_var(&ge->y);
+	secp256k1_fe_get_b32(pub + 1, &ge->x);
+	pub[0] = secp256k1_fe_is_odd(&ge->y) ? SECP256K1_TAG_PUBKEY_ODD : SECP256K1_TAG_PUBKEY_EVEN;
+}
+
+// n as field element and p - n, see ecdsa_impl.h.
+static const secp256k1_fe _order_as_fe = SECP256K1_FE_CONST(
+	0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFEUL,
+	0xBAAEDCE6UL, 0xAF48A03BUL, 0xBFD25E8CUL, 0xD0364141UL
+);
+
+static const secp256k1_fe _p_minus_order = SECP256K1_FE_CONST(
+	0, 0, 0, 1, 0x45512319UL, 0x50B75FC4UL, 0x402DA172UL, 0x2FC9BAEEUL
+);
+
+// Parse a 65 byte eosio signature (27 + 4 + recovery id, r, s) with the same rules as
+// secp256k1_ecdsa_recoverable_signature_parse_compact() followed by secp256k1_ecdsa_verify():
+// r and s below n, not zero and s in the lower half. Returns the recovery id or -1.
+SECP256K1_INLINE static int _parse_rs(secp256k1_scalar *r, secp256k1_scalar *s, const unsigned char *sig) {
+
+	int overflow, recid = sig[0] - 27 - 4;
+
+	if (recid < 0 || recid > 3) {
+		return -1;
+	}
+
+	secp256k1_scalar_set_b32(r, sig + 1, &overflow);
+	if (overflow || secp256k1_scalar_is_zero(r)) {
+		return -1;
+	}
+
+	secp256k1_scalar_set_b32(s, sig + 33, &overflow);
+	if (overflow || secp256k1_scalar_is_zero(s) || secp256k1_scalar_is_high(s)) {
+		return -1;
+	}
+
+	return recid;
+}
+
+#endif /* LIBEOSIO_LIBSECP256K1_INTERNAL_H */
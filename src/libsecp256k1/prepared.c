@@ -0,0 +1,192 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * secp256k1_ecdsa_verify() decompresses the public key (a field square root) and builds
+ * a small table of multiples of it (window 5) on every call before the actual double
+ * scalar multiplication. A prepared key does both once: the point is kept parsed and the
+ * optional table uses a window of PREPARED_WINDOW, so the key part of the multiplication
+ * needs about half the point additions. As in libsecp256k1 the scalar is split with the
+ * endomorphism, lambda * P is (beta * x, y) so one table serves both halves.
+ */
+#include <stdlib.h>
+#include "internal.h"
+#include "ecmult_impl.h"
+#include "scratch_impl.h" // used by ecmult_impl.h
+#include "prepared.h"
+
+#define PREPARED_TABLE_SIZE ECMULT_TABLE_SIZE(PREPARED_WINDOW)
+
+struct prepared_key {
+	secp256k1_ge ge;
+	secp256k1_ge_storage *pre; // NULL without table.
+};
+
+static int _build_table(prepared_key *key) {
+
+	secp256k1_gej *jac;
+	secp256k1_ge *aff, twice;
+	size_t i;
+	int ret = 0;
+
+	jac = (secp256k1_gej *) malloc(PREPARED_TABLE_SIZE * sizeof(secp256k1_gej));
+	aff = (secp256k1_ge *) malloc(PREPARED_TABLE_SIZE * sizeof(secp256k1_ge));
+	key->pre = (secp256k1_ge_storage *) malloc(PREPARED_TABLE_SIZE * sizeof(secp256k1_ge_storage));
+	if (jac == NULL || aff == NULL || key->pre == NULL) {
+		goto out;
+	}
+
+	// P, 3P, 5P, ... one addition of 2P each, then a single inversion for all of them.
+	secp256k1_gej_set_ge(&jac[0], &key->ge);
+	secp256k1_gej_double_var(&jac[1], &jac[0], NULL);
+	secp256k1_ge_set_gej_var(&twice, &jac[1]);
+	for (i = 1; i < PREPARED_TABLE_SIZE; i++) {
+		secp256k1_gej_add_ge_var(&jac[i], &jac[i - 1], &twice, NULL);
+	}
+
+	secp256k1_ge_set_all_gej_var(aff, jac, PREPARED_TABLE_SIZE);
+	for (i = 0; i < PREPARED_TABLE_SIZE; i++) {
+		secp256k1_ge_to_storage(&key->pre[i], &aff[i]);
+	}
+
+	ret = 1;
+out:
+	free(jac);
+	free(aff);
+	return ret;
+}
+
+prepared_key *prepared_key_create(const unsigned char *pubkey, int table) {
+
+	prepared_key *key = (prepared_key *) malloc(sizeof(prepared_key));
+
+	if (key == NULL) {
+		return NULL;
+	}
+
+	key->pre = NULL;
+	if (!_parse_compressed(&key->ge, pubkey) || (table && !_build_table(key))) {
+		prepared_key_destroy(key);
+		return NULL;
+	}
+
+	return key;
+}
+
+void prepared_key_destroy(prepared_key *key) {
+	if (key != NULL) {
+		free(key->pre);
+		free(key);
+	}
+}
+
+// r = na * P + ng * G, secp256k1_ecmult() with the table of the key.
+static void _ecmult_table(secp256k1_gej *r, const prepared_key *key, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+
+	secp256k1_scalar na_1, na_lam, ng_1, ng_128;
+	int wnaf_na_1[129], wnaf_na_lam[129], wnaf_ng_1[129], wnaf_ng_128[129];
+	int bits_na_1, bits_na_lam, bits_ng_1, bits_ng_128, bits, i, n;
+	secp256k1_ge tmpa;
+
+	secp256k1_scalar_split_lambda(&na_1, &na_lam, na);
+	secp256k1_scalar_split_128(&ng_1, &ng_128, ng);
+
+	bits_na_1   = secp256k1_ecmult_wnaf(wnaf_na_1,   129, &na_1,   PREPARED_WINDOW);
+	bits_na_lam = secp256k1_ecmult_wnaf(wnaf_na_lam, 129, &na_lam, PREPARED_WINDOW);
+	bits_ng_1   = secp256k1_ecmult_wnaf(wnaf_ng_1,   129, &ng_1,   WINDOW_G);
+	bits_ng_128 = secp256k1_ecmult_wnaf(wnaf_ng_128, 129, &ng_128, WINDOW_G);
+
+	bits = bits_na_1;
+	if (bits_na_lam > bits) {
+		bits = bits_na_lam;
+	}
+	if (bits_ng_1 > bits) {
+		bits = bits_ng_1;
+	}
+	if (bits_ng_128 > bits) {
+		bits = bits_ng_128;
+	}
+
+	secp256k1_gej_set_infinity(r);
+
+	for (i = bits - 1; i >= 0; i--) {
+		secp256k1_gej_double_var(r, r, NULL);
+		if (i < bits_na_1 && (n = wnaf_na_1[i])) {
+			secp256k1_ecmult_table_get_ge_storage(&tmpa, key->pre, n, PREPARED_WINDOW);
+			secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+		}
+		if (i < bits_na_lam && (n = wnaf_na_lam[i])) {
+			secp256k1_ecmult_table_get_ge_storage(&tmpa, key->pre, n, PREPARED_WINDOW);
+			secp256k1_ge_mul_lambda(&tmpa, &tmpa);
+			secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+		}
+		if (i < bits_ng_1 && (n = wnaf_ng_1[i])) {
+			secp256k1_ecmult_table_get_ge_storage(&tmpa, secp256k1_pre_g, n, WINDOW_G);
+			secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+		}
+		if (i < bits_ng_128 && (n = wnaf_ng_128[i])) {
+			secp256k1_ecmult_table_get_ge_storage(&tmpa, secp256k1_pre_g_128, n, WINDOW_G);
+			secp256k1_gej_add_ge_var(r, r, &tmpa, NULL);
+		}
+	}
+}
+
+int prepared_key_verify(const prepared_key *key, const unsigned char *digest, const unsigned char *sig) {
+
+	secp256k1_scalar r, s, z, sn, u1, u2;
+	secp256k1_gej pr, pj;
+	secp256k1_fe xr;
+
+	if (_parse_rs(&r, &s, sig) < 0) {
+		return 0;
+	}
+
+	secp256k1_scalar_set_b32(&z, digest, NULL);
+	secp256k1_scalar_inverse_var(&sn, &s);
+	secp256k1_scalar_mul(&u1, &sn, &z);
+	secp256k1_scalar_mul(&u2, &sn, &r);
+
+	if (key->pre != NULL) {
+		_ecmult_table(&pr, key, &u2, &u1);
+	} else {
+		secp256k1_gej_set_ge(&pj, &key->ge);
+		secp256k1_ecmult(&pr, &pj, &u2, &u1);
+	}
+
+	if (secp256k1_gej_is_infinity(&pr)) {
+		return 0;
+	}
+
+	// x(pr) mod n == r without an inversion, see secp256k1_ecdsa_sig_verify(). r < n < p,
+	// so it is a field element as well.
+	secp256k1_fe_set_b32(&xr, sig + 1);
+	if (secp256k1_gej_eq_x_var(&xr, &pr)) {
+		return 1;
+	}
+	if (secp256k1_fe_cmp_var(&xr, &_p_minus_order) >= 0) {
+		return 0;
+	}
+	secp256k1_fe_add(&xr, &_order_as_fe);
+	return secp256k1_gej_eq_x_var(&xr, &pr);
+}
@@ -0,0 +1,61 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_PREPARED_H
+#define LIBEOSIO_LIBSECP256K1_PREPARED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Window of the precomputed table, it holds the odd multiples P, 3P, ... of the key up to
+ * (2^(PREPARED_WINDOW - 1) - 1) P, 2^(PREPARED_WINDOW - 2) points of 64 bytes.
+ */
+#define PREPARED_WINDOW 10
+
+typedef struct prepared_key prepared_key;
+
+/**
+ * Parse the compressed public key `pubkey` (33 bytes) for repeated verifications,
+ * with `table` non zero the precomputed table is built as well.
+ *
+ * returns NULL if the key is invalid or memory could not be allocated.
+ */
+prepared_key *prepared_key_create(const unsigned char *pubkey, int table);
+
+void prepared_key_destroy(prepared_key *key);
+
+/**
+ * Verify the 65 byte eosio signature `sig` (27 + 4 + recovery id, r, s) of the 32 byte
+ * `digest`, same result as secp256k1_ecdsa_verify().
+ *
+ * returns 1 if the signature is valid, 0 otherwise.
+ */
+int prepared_key_verify(const prepared_key *key, const unsigned char *digest, const unsigned char *sig);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEOSIO_LIBSECP256K1_PREPARED_H */
@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "internal.h"
+#include "sequential.h"
+
+int sequential_keys(const unsigned char *seckey, const unsigned char *pubkey, size_t count,
+	unsigned char *out_sec, unsigned char *out_pub, size_t stride) {
+
+	secp256k1_scalar k, one;
+	secp256k1_gej acc;
+	secp256k1_gej *jac;
+	secp256k1_ge start, *aff;
+	size_t i, n, batch;
+	int overflow, ret = 0;
+
+	secp256k1_scalar_set_b32(&k, seckey, &overflow);
+	if (overflow || secp256k1_scalar_is_zero(&k)) {
+		return 0;
+	}
+
+	if (!_parse_compressed(&start, pubkey)) {
+		return 0;
+	}
+
+	batch = count < SEQUENTIAL_BATCH ? count : SEQUENTIAL_BATCH;
+	jac = (secp256k1_gej *) malloc(batch * sizeof(secp256k1_gej));
+	aff = (secp256k1_ge *) malloc(batch * sizeof(secp256k1_ge));
+	if (jac == NULL || aff == NULL) {
+		goto out;
+	}
+
+	secp256k1_scalar_set_int(&one, 1);
+	secp256k1_gej_set_ge(&acc, &start);
+
+	for (n = 0; n < count; n += batch) {
+
+		if (batch > count - n) {
+			batch = count - n;
+		}
+
+		// One point addition per key, the points stay in jacobian coordinates.
+		for (i = 0; i < batch; i++) {
+			if (n + i > 0) {
+				secp256k1_gej_add_ge_var(&acc, &acc, &secp256k1_ge_const_g, NULL);
+				secp256k1_scalar_add(&k, &k, &one);
+			}
+
+			// k + i == 0 mod n, the point at infinity has no public key.
+			if (secp256k1_gej_is_infinity(&acc)) {
+				goto out;
+			}
+
+			jac[i] = acc;
+			secp256k1_scalar_get_b32(out_sec + (n + i) * stride, &k);
+		}
+
+		// Montgomery's trick: one inversion for the whole batch.
+		secp256k1_ge_set_all_gej_var(aff, jac, batch);
+
+		for (i = 0; i < batch; i++) {
+			_serialize_compressed(&aff[i], out_pub + (n + i) * stride);
+		}
+	}
+
+	ret = 1;
+out:
+	secp256k1_scalar_clear(&k);
+	free(jac);
+	free(aff);
+	return ret;
+}
@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_SEQUENTIAL_H
+#define LIBEOSIO_LIBSECP256K1_SEQUENTIAL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Number of points converted to affine coordinates with one field inversion.
+ */
+#define SEQUENTIAL_BATCH 2048
+
+/**
+ * Derive the keys with secrets k, k + 1, ..., k + count - 1.
+ *
+ * `seckey` is k (32 bytes, big endian) and `pubkey` the compressed public key of k.
+ * Each following public key is the previous one plus G, and the points are brought
+ * back to affine coordinates SEQUENTIAL_BATCH at a time with a single inversion.
+ *
+ * Secret i is written to `out_sec + i * stride` (32 bytes) and public key i to
+ * `out_pub + i * stride` (33 bytes, compressed).
+ *
+ * returns 1 on success, 0 if the input is invalid, a secret in the range is zero
+ * (k + i wrapped around the group order) or memory could not be allocated.
+ */
+int sequential_keys(const unsigned char *seckey, const unsigned char *pubkey, size_t count,
+	unsigned char *out_sec, unsigned char *out_pub, size_t stride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEOSIO_LIBSECP256K1_SEQUENTIAL_H */
@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * secp256k1_ecdsa_sign_recoverable() parses and range checks the private key on every
+ * call before it signs. A signer key keeps the parsed scalar and calls the signing
+ * primitive of libsecp256k1 directly, with a generator context of its own as the one
+ * in secp256k1_context can not be reached from outside the library.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "internal.h"
+#include "ecmult_gen_impl.h"
+#include "ecmult_impl.h"
+#include "scratch_impl.h" // used by ecmult_impl.h
+#include "ecdsa_impl.h"
+#include "signer.h"
+
+struct signer_key {
+	unsigned char seckey[32]; // Input to the nonce function.
+	secp256k1_scalar sec;
+	secp256k1_ecmult_gen_context gen;
+};
+
+signer_key *signer_key_create(const unsigned char *seckey, const unsigned char *seed32) {
+
+	signer_key *key = (signer_key *) malloc(sizeof(signer_key));
+
+	if (key == NULL) {
+		return NULL;
+	}
+
+	if (!secp256k1_scalar_set_b32_seckey(&key->sec, seckey)) {
+		free(key);
+		return NULL;
+	}
+
+	memcpy(key->seckey, seckey, sizeof(key->seckey));
+	secp256k1_ecmult_gen_context_build(&key->gen);
+	secp256k1_ecmult_gen_blind(&key->gen, seed32);
+	return key;
+}
+
+void signer_key_destroy(signer_key *key) {
+	if (key != NULL) {
+		memset(key->seckey, 0, sizeof(key->seckey));
+		secp256k1_scalar_clear(&key->sec);
+		secp256k1_ecmult_gen_context_clear(&key->gen);
+		free(key);
+	}
+}
+
+int signer_key_sign(const signer_key *key, const unsigned char *digest, unsigned int counter,
+	unsigned char *sig64, int *recid) {
+
+	secp256k1_scalar msg, non, r, s;
+	unsigned char nonce32[32];
+	int ret;
+
+	secp256k1_scalar_set_b32(&msg, digest, NULL);
+
+	ret = secp256k1_nonce_function_rfc6979(nonce32, digest, key->seckey, NULL, NULL, counter)
+		&& secp256k1_scalar_set_b32_seckey(&non, nonce32)
+		&& secp256k1_ecdsa_sig_sign(&key->gen, &r, &s, &key->sec, &msg, &non, recid);
+
+	if (ret) {
+		secp256k1_scalar_get_b32(sig64, &r);
+		secp256k1_scalar_get_b32(sig64 + 32, &s);
+	}
+
+	memset(nonce32, 0, sizeof(nonce32));
+	secp256k1_scalar_clear(&non);
+	return ret;
+}
@@ -0,0 +1,57 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_LIBSECP256K1_SIGNER_H
+#define LIBEOSIO_LIBSECP256K1_SIGNER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct signer_key signer_key;
+
+/**
+ * Parse the private key `seckey` (32 bytes) for repeated signing. The key gets its own
+ * generator context, blinded with the 32 bytes at `seed32`.
+ *
+ * returns NULL if the key is invalid or memory could not be allocated.
+ */
+signer_key *signer_key_create(const unsigned char *seckey, const unsigned char *seed32);
+
+void signer_key_destroy(signer_key *key);
+
+/**
+ * Sign the 32 byte `digest` with the RFC 6979 nonce of attempt `counter`, same result as
+ * secp256k1_ecdsa_sign_recoverable() with that nonce. The signature is written to `sig64`
+ * (r, s) and the recovery id to `recid`.
+ *
+ * returns 1 on success, 0 if the nonce or signature is invalid.
+ */
+int signer_key_sign(const signer_key *key, const unsigned char *digest, unsigned int counter,
+	unsigned char *sig64, int *recid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEOSIO_LIBSECP256K1_SIGNER_H */
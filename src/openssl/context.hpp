@@ -0,0 +1,64 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_OPENSSL_CONTEXT_H
+#define LIBEOSIO_OPENSSL_CONTEXT_H
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <libeosio/ec.hpp>
+
+namespace libeosio { namespace internal { namespace openssl {
+
+/**
+ * OpenSSL objects are built once per context and reused by every call, a context
+ * is used by one thread at a time so there is no locking.
+ */
+struct context {
+	BN_CTX *ctx;
+	EC_KEY *k;          // Key generation, public key calculation and signing.
+	EC_KEY *vk;         // Public key of verify().
+	EC_POINT *point;    // Computed or recovered public key.
+	EC_POINT *R;        // Nonce point of sign(), R of recover().
+	ECDSA_SIG *sig;     // Signature of verify(), owns `r` and `s`.
+	BIGNUM *r, *s;
+	BIGNUM *nonce, *kinv, *nr;  // Nonce setup of sign(), on the secure heap.
+};
+
+// Functions of the backend table defined in ecdsa.cpp.
+int sign(void *state, const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig);
+int verify(void *state, const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& key);
+int verify_batch(void *state, const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid);
+int verify_prepared(void *state, const sha256_t* digest, const ec_signature_t& sig, const void *key);
+int recover(void *state, const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key);
+
+void* signer_new(void *state, const ec_privkey_t& key);
+void signer_free(void *signer);
+int signer_sign(void *state, void *signer, const sha256_t* digest, ec_signature_t& sig);
+
+void* prepared_new(const ec_pubkey_t& key, bool precompute);
+void prepared_free(void *key);
+
+}}} // namespace libeosio::internal::openssl
+
+#endif /* LIBEOSIO_OPENSSL_CONTEXT_H */
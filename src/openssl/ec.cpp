@@ -25,43 +25,78 @@
 #include <openssl/bn.h>
 #include <openssl/hmac.h>
 #include <libeosio/ec.hpp>
+#include "../ec_backend.hpp"
+#include "context.hpp"
 #include "internal.h"
+#include <vector>
 
-namespace libeosio {
+namespace libeosio { namespace internal { namespace openssl {
 
-BN_CTX *ctx = NULL;
-EC_KEY *k = NULL;
+/**
+ * Number of points converted to affine coordinates with one field inversion.
+ */
+#define SEQUENTIAL_BATCH 1024
 
-int ec_init() {
+static void _free(context *p) {
+	ECDSA_SIG_free(p->sig);  // Frees r and s.
+	BN_clear_free(p->nonce);
+	BN_clear_free(p->kinv);
+	BN_free(p->nr);
+	EC_POINT_free(p->R);
+	EC_POINT_free(p->point);
+	EC_KEY_free(p->vk);
+	EC_KEY_free(p->k);
+	BN_CTX_free(p->ctx);
+	delete p;
+}
 
-	ctx = BN_CTX_new();
-	if (ctx == NULL) {
-		return -1;
+static void* context_new() {
+
+	context *p = new context();
+	const EC_GROUP *group;
+
+	p->ctx = BN_CTX_new();
+	p->k = EC_KEY_new_by_curve_name(NID_secp256k1);
+	p->vk = EC_KEY_new_by_curve_name(NID_secp256k1);
+	p->sig = ECDSA_SIG_new();
+	p->r = BN_new();
+	p->s = BN_new();
+	p->nonce = BN_secure_new();
+	p->kinv = BN_secure_new();
+	p->nr = BN_new();
+
+	if (p->k && (group = EC_KEY_get0_group(p->k)) != NULL) {
+		p->point = EC_POINT_new(group);
+		p->R = EC_POINT_new(group);
 	}
 
-	// Construct curve.
-	k = EC_KEY_new_by_curve_name(NID_secp256k1);
-	if (k == NULL) {
-		BN_CTX_free(ctx);
-		return -1;
+	// The signature takes ownership of r and s, they stay valid until it is freed.
+	if (p->sig && p->r && p->s && ECDSA_SIG_set0(p->sig, p->r, p->s) == 1) {
+		if (p->ctx && p->k && p->vk && p->point && p->R && p->nonce && p->kinv && p->nr) {
+			return p;
+		}
+	} else {
+		BN_free(p->r);
+		BN_free(p->s);
 	}
 
-	return 0;
+	_free(p);
+	return NULL;
 }
 
-void ec_shutdown() {
-	if (ctx) {
-		BN_CTX_free(ctx);
-		ctx = NULL;
-	}
+static void context_free(void *state) {
+	_free((context*) state);
+}
 
-	if (k) {
-		EC_KEY_free(k);
-		k = NULL;
-	}
+// OpenSSL blinds every operation on its own.
+static void set_randomize_interval(void *state, std::size_t keys) {
+	(void) state;
+	(void) keys;
 }
 
-int ec_generate_privkey(ec_privkey_t *priv) {
+static int generate_privkey(void *state, ec_privkey_t *priv) {
+
+	EC_KEY *k = ((context*) state)->k;
 
 	// Generate new private key.
 	if (EC_KEY_generate_key(k) == 0)  {
@@ -75,11 +110,12 @@ int ec_generate_privkey(ec_privkey_t *priv) {
 	return 0;
 }
 
-int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
+static int get_publickey(void *state, const ec_privkey_t *priv, ec_pubkey_t* pub) {
 
-	int rc = -1;
+	context *p = (context*) state;
+	BN_CTX *ctx = p->ctx;
+	EC_KEY *k = p->k;
 	const EC_GROUP *group;
-	EC_POINT *point;
 
 	// Load private key
 	if (EC_KEY_oct2priv(k, priv->data(), EC_PRIVKEY_SIZE) == 0) {
@@ -90,20 +126,23 @@ int ec_get_publickey(const ec_privkey_t *priv, ec_pubkey_t* pub) {
 		return -1;
 	}
 
-	if (calculate_pubkey(group, k, &point) == 0) {
+	if (EC_POINT_mul(group, p->point, EC_KEY_get0_private_key(k), NULL, NULL, ctx) == 0) {
 		return -1;
 	}
 
 	// Encode public key
-	if (EC_POINT_encode(group, point, pub->data(), EC_PUBKEY_SIZE, ctx) != 0) {
-		rc = 0;
+	if (EC_POINT_encode(group, p->point, pub->data(), EC_PUBKEY_SIZE, ctx) == 0) {
+		return -1;
 	}
 
-	EC_POINT_free(point);
-	return rc;
+	return 0;
 }
 
-int ec_generate_key(struct ec_keypair *pair) {
+static int generate_key(void *state, struct ec_keypair *pair) {
+
+	context *p = (context*) state;
+	BN_CTX *ctx = p->ctx;
+	EC_KEY *k = p->k;
 
 	// Generate new key pair.
 	if (EC_KEY_generate_key(k) != 1)  {
@@ -121,4 +160,126 @@ int ec_generate_key(struct ec_keypair *pair) {
 	return 0;
 }
 
-} // namespace libeosio
+static int derive_keys_sequential(void *state, const ec_privkey_t& base, uint64_t offset, struct ec_keypair *pairs, std::size_t count) {
+
+	context *p = (context*) state;
+	BN_CTX *ctx = p->ctx;
+	const EC_GROUP *group;
+	const EC_POINT *g;
+	const BIGNUM *order;
+	BIGNUM *k = NULL, *off = NULL;
+	EC_POINT *acc = NULL;
+	std::vector<EC_POINT*> points;
+	unsigned char buf[8];
+	std::size_t i, n, batch;
+	int rc = -1;
+
+	if (count == 0) {
+		return 0;
+	}
+
+	group = EC_KEY_get0_group(p->k);
+	g = EC_GROUP_get0_generator(group);
+	order = EC_GROUP_get0_order(group);
+
+	for (i = 0; i < 8; i++) {
+		buf[7 - i] = (unsigned char) (offset >> (i * 8));
+	}
+
+	k = BN_bin2bn(base.data(), EC_PRIVKEY_SIZE, NULL);
+	off = BN_bin2bn(buf, sizeof(buf), NULL);
+	acc = EC_POINT_new(group);
+	if (k == NULL || off == NULL || acc == NULL) {
+		goto out;
+	}
+	BN_set_flags(k, BN_FLG_CONSTTIME);
+
+	// Base must be a valid private key, start = base + offset (mod n).
+	if (BN_is_zero(k) || BN_cmp(k, order) >= 0 || !BN_mod_add(k, k, off, order, ctx) || BN_is_zero(k)) {
+		goto out;
+	}
+
+	// The first point is a regular scalar multiplication.
+	if (!EC_POINT_mul(group, acc, k, NULL, NULL, ctx)) {
+		goto out;
+	}
+
+	batch = count < SEQUENTIAL_BATCH ? count : SEQUENTIAL_BATCH;
+	points.resize(batch, NULL);
+	for (i = 0; i < batch; i++) {
+		if ((points[i] = EC_POINT_new(group)) == NULL) {
+			goto out;
+		}
+	}
+
+	for (n = 0; n < count; n += batch) {
+
+		if (batch > count - n) {
+			batch = count - n;
+		}
+
+		// One point addition per key, make_affine() shares one inversion for the batch.
+		for (i = 0; i < batch; i++) {
+			if (n + i > 0) {
+				if (!EC_POINT_add(group, acc, acc, g, ctx) || !BN_add_word(k, 1)) {
+					goto out;
+				}
+				// k + i == 0 mod n, the point at infinity has no public key.
+				if (BN_cmp(k, order) == 0) {
+					goto out;
+				}
+			}
+
+			if (!EC_POINT_copy(points[i], acc)
+				|| BN_bn2binpad(k, pairs[n + i].secret.data(), EC_PRIVKEY_SIZE) != EC_PRIVKEY_SIZE) {
+				goto out;
+			}
+		}
+
+		if (!EC_POINTs_make_affine(group, batch, points.data(), ctx)) {
+			goto out;
+		}
+
+		for (i = 0; i < batch; i++) {
+			if (EC_POINT_encode(group, points[i], pairs[n + i].pub.data(), EC_PUBKEY_SIZE, ctx) != EC_PUBKEY_SIZE) {
+				goto out;
+			}
+		}
+	}
+
+	rc = 0;
+out:
+	for (i = 0; i < points.size(); i++) {
+		EC_POINT_free(points[i]);
+	}
+	EC_POINT_free(acc);
+	BN_free(off);
+	BN_clear_free(k);
+	return rc;
+}
+
+} // namespace openssl
+
+const ec_backend ec_backend_openssl = {
+	EC_BACKEND_OPENSSL,
+	"openssl",
+	openssl::context_new,
+	openssl::context_free,
+	openssl::set_randomize_interval,
+	openssl::generate_privkey,
+	openssl::get_publickey,
+	openssl::generate_key,
+	openssl::derive_keys_sequential,
+	openssl::sign,
+	openssl::verify,
+	openssl::verify_batch,
+	openssl::verify_prepared,
+	openssl::recover,
+	openssl::signer_new,
+	openssl::signer_free,
+	openssl::signer_sign,
+	openssl::prepared_new,
+	openssl::prepared_free,
+};
+
+}} // namespace libeosio::internal
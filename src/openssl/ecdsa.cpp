@@ -25,161 +25,235 @@
 #include <openssl/bn.h>
 #include <openssl/ecdsa.h>
 #include <libeosio/ec.hpp>
+#include "context.hpp"
 #include "internal.h"
 
-namespace libeosio {
+namespace libeosio { namespace internal { namespace openssl {
 
-extern BN_CTX *ctx;
+// Pick a nonce `k` and compute r = R.x mod n and kinv = 1/k mod n. `recid` is taken
+// from R directly: bit 0 is the parity of R.y and bit 1 is set when R.x >= n.
+static int _sign_setup(context *p, const EC_GROUP *group, int *recid) {
 
-int ecdsa_sign(const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
+	BN_CTX *ctx = p->ctx;
+	const BIGNUM *order = EC_GROUP_get0_order(group);
+	BIGNUM *x, *y;
+	int ret = 0;
 
-	int rc = -1;
-	EC_POINT *pub;
-	const EC_GROUP *group;
-	ECDSA_SIG *ecdsa_sig;
-	EC_KEY *ec_key;
-
-	if ((ec_key = EC_KEY_new_secp256k1()) == NULL) {
-		return -1;
+	BN_CTX_start(ctx);
+	x = BN_CTX_get(ctx);
+	y = BN_CTX_get(ctx);
+	if (y == NULL) {
+		goto err;
 	}
 
-	if (EC_KEY_oct2priv(ec_key, key.data(), key.size()) < 0) {
-		goto err1;
-	}
+	do {
+		do {
+			if (BN_priv_rand_range(p->nonce, order) == 0) {
+				goto err;
+			}
+		} while (BN_is_zero(p->nonce));
 
-	group = EC_KEY_get0_group(ec_key);
-	if (group == NULL) {
-		goto err1;
-	}
+		BN_set_flags(p->nonce, BN_FLG_CONSTTIME);
+		if (EC_POINT_mul(group, p->R, p->nonce, NULL, NULL, ctx) == 0
+			|| EC_POINT_get_affine_coordinates(group, p->R, x, y, ctx) == 0
+			|| BN_nnmod(p->nr, x, order, ctx) == 0) {
+			goto err;
+		}
+	} while (BN_is_zero(p->nr));
 
-	if (calculate_pubkey(group, ec_key, &pub) == 0) {
-		goto err2;
+	if (BN_mod_inverse(p->kinv, p->nonce, order, ctx) == NULL) {
+		goto err;
 	}
 
-	while (1) {
-		int recid = -1;
-		const BIGNUM *r, *s;
-		EC_KEY* tmpk;
+	*recid = BN_is_odd(y) | (BN_cmp(x, order) >= 0) << 1;
+	ret = 1;
 
-		ecdsa_sig = ECDSA_do_sign((const unsigned char*) digest, 32, ec_key);
-		if (ecdsa_sig == NULL) {
-			goto err2;
-		}
+err:
+	BN_CTX_end(ctx);
+	return ret;
+}
 
-		// Get R and S numbers.
-		r = ECDSA_SIG_get0_r(ecdsa_sig);
-		s = ECDSA_SIG_get0_s(ecdsa_sig);
+// Sign with `ec_key`, which holds the private key. EOSIO only accepts canonical
+// signatures, ECDSA_SIG_serialize() fails on the others and a new one is made.
+static int _sign(context *p, EC_KEY *ec_key, const sha256_t* digest, ec_signature_t& sig) {
 
-		tmpk = EC_KEY_new_by_curve_name( NID_secp256k1 );
-		for (int i = 0; i < 4; i++) {
-			if (ECDSA_SIG_recover_key_GFp(tmpk, r, s, (const unsigned char*) digest, 32, i, 1) == 1) {
-				const EC_POINT *p = EC_KEY_get0_public_key(tmpk);
+	const EC_GROUP *group = EC_KEY_get0_group(ec_key);
+	int rc = -1;
 
-				// Compare public keys
-				if (EC_POINT_cmp(group, pub, p, ctx) == 0) {
-					recid = i;
-					break;
-				}
-			}
-		}
+	while (1) {
+		int recid, done;
+		ECDSA_SIG *ecdsa_sig;
 
-		EC_KEY_free( tmpk );
+		if (_sign_setup(p, group, &recid) == 0) {
+			break;
+		}
 
-		// Could not find recovery id.
-		if (recid == -1) {
-			goto err2;
+		// The signature is allocated by OpenSSL, there is no variant that fills an existing one.
+		ecdsa_sig = ECDSA_do_sign_ex((const unsigned char*) digest, 32, p->kinv, p->nr, ec_key);
+		if (ecdsa_sig == NULL) {
+			break;
 		}
 
-		if (ECDSA_SIG_serialize(ecdsa_sig, recid, sig.data()) == 0) {
-			goto out;
+		done = ECDSA_SIG_serialize(ecdsa_sig, recid, sig.data()) == 0;
+		ECDSA_SIG_free(ecdsa_sig);
+
+		if (done) {
+			rc = 0;
+			break;
 		}
 	}
 
-out:	rc = 0;
-err2:
-	EC_POINT_free(pub);
-err1:
-	EC_KEY_free(ec_key);
+	BN_clear(p->nonce);
+	BN_clear(p->kinv);
 	return rc;
 }
 
-int ecdsa_verify(const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& pub) {
+int sign(void *state, const ec_privkey_t& key, const sha256_t* digest, ec_signature_t& sig) {
 
-	int recid, ret = -1;
-	EC_POINT *point;
-	const EC_GROUP *group;
-	ECDSA_SIG* ecdsa_sig;
-	EC_KEY *ec_key;
+	context *p = (context*) state;
 
-	ec_key = EC_KEY_new_by_curve_name( NID_secp256k1 );
-	if (ec_key == NULL) {
+	if (EC_KEY_oct2priv(p->k, key.data(), key.size()) != 1) {
 		return -1;
 	}
 
-	if ((ecdsa_sig = ECDSA_SIG_new()) == NULL) {
-		goto err1;
-	}
+	return _sign(p, p->k, digest, sig);
+}
+
+// A signer is an EC_KEY holding the validated private key.
+void* signer_new(void *state, const ec_privkey_t& key) {
+
+	const EC_GROUP *group;
+	const BIGNUM *priv;
+	EC_KEY *k;
+
+	(void) state;
 
-	if (ECDSA_SIG_unserialize(sig.data(), ecdsa_sig, &recid) == 0) {
-		goto err2;
+	if ((k = EC_KEY_new_secp256k1()) == NULL) {
+		return NULL;
 	}
 
-	if ((group = EC_KEY_get0_group(ec_key)) == NULL) {
-		goto err2;
+	group = EC_KEY_get0_group(k);
+
+	// 0 < key < n
+	if (EC_KEY_oct2priv(k, key.data(), key.size()) != 1
+		|| (priv = EC_KEY_get0_private_key(k)) == NULL
+		|| BN_is_zero(priv) || BN_cmp(priv, EC_GROUP_get0_order(group)) >= 0) {
+		EC_KEY_free(k);
+		return NULL;
 	}
 
-	if ((point = EC_POINT_new(group)) == NULL) {
-		goto err2;
+	return k;
+}
+
+void signer_free(void *signer) {
+	EC_KEY_free((EC_KEY*) signer);
+}
+
+int signer_sign(void *state, void *signer, const sha256_t* digest, ec_signature_t& sig) {
+	return _sign((context*) state, (EC_KEY*) signer, digest, sig);
+}
+
+int verify(void *state, const sha256_t* digest, const ec_signature_t& sig, const ec_pubkey_t& pub) {
+
+	context *p = (context*) state;
+	int recid;
+
+	// oct2key() decodes into the key's existing point, set_public_key() would copy it.
+	if (ECDSA_SIG_unserialize(sig.data(), p->r, p->s, &recid) == 0
+		|| EC_KEY_oct2key(p->vk, pub.data(), EC_PUBKEY_SIZE, p->ctx) != 1) {
+		return -1;
 	}
 
-	if (EC_POINT_oct2point(group, point, pub.data(), EC_PUBKEY_SIZE, ctx) == 0) {
-		goto err3;
+	if (ECDSA_do_verify((const unsigned char*) digest, 32, p->sig, p->vk) != 1) {
+		return -1;
 	}
 
-	if (EC_KEY_set_public_key(ec_key, point) == 0) {
-		goto err3;
+	return 0;
+}
+
+// OpenSSL has no precomputation for points other than the generator, `precompute` is ignored.
+void* prepared_new(const ec_pubkey_t& key, bool precompute) {
+
+	EC_KEY *k;
+
+	(void) precompute;
+
+	if ((k = EC_KEY_new_secp256k1()) == NULL) {
+		return NULL;
 	}
 
-	if (ECDSA_do_verify((const unsigned char*) digest, 32, ecdsa_sig, ec_key) == 1) {
-		ret = 0;
+	if (EC_KEY_oct2key(k, key.data(), EC_PUBKEY_SIZE, NULL) != 1) {
+		EC_KEY_free(k);
+		return NULL;
 	}
 
-err3:	EC_POINT_free(point);
-err2:	ECDSA_SIG_free(ecdsa_sig);
-err1:	EC_KEY_free(ec_key);
-	return ret;
+	return k;
+}
+
+void prepared_free(void *key) {
+	EC_KEY_free((EC_KEY*) key);
 }
 
-int ecdsa_recover(const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key) {
+// Verifications only read the key, it is not const in the OpenSSL API.
+int verify_prepared(void *state, const sha256_t* digest, const ec_signature_t& sig, const void *key) {
 
+	context *p = (context*) state;
 	int recid;
-	int ret = -1;
-	BIGNUM *r, *s;
-	EC_KEY *ec_key;
 
-	// Initialize ec variables.
-	if ((ec_key = EC_KEY_new_secp256k1()) == NULL) goto err1;
+	if (ECDSA_SIG_unserialize(sig.data(), p->r, p->s, &recid) == 0
+		|| ECDSA_do_verify((const unsigned char*) digest, 32, p->sig, (EC_KEY*) key) != 1) {
+		return -1;
+	}
 
-	// Unserialize signature into r,s,recid components.
-	ECDSA_SIG_unserialize_rs(sig.data(), &r, &s, &recid);
+	return 0;
+}
 
-	// Recover public key.
-	if (ECDSA_SIG_recover_key_GFp(ec_key, r, s, (const unsigned char*) digest, 32, recid, 1) == 1) {
+// OpenSSL has no multi scalar multiplication outside of its deprecated EC_POINTs_mul(),
+// the signatures are verified one by one.
+int verify_batch(void *state, const sha256_t* digests, const ec_signature_t* sigs, const ec_pubkey_t* keys, std::size_t count, bool* valid) {
 
-		// Encode point to binary compressed format.
-		const EC_POINT *p = EC_KEY_get0_public_key(ec_key);
-		const EC_GROUP *g = EC_KEY_get0_group(ec_key);
-		if (EC_POINT_encode(g, p, key.data(), EC_PUBKEY_SIZE, ctx) == 0) {
-			goto err4;
+	int ret = 0;
+
+	for (std::size_t i = 0; i < count; i++) {
+		bool ok = verify(state, digests + i, sigs[i], keys[i]) == 0;
+		if (valid) {
+			valid[i] = ok;
 		}
+		if (!ok) {
+			ret = -1;
+			if (!valid) {
+				break;
+			}
+		}
+	}
+
+	return ret;
+}
+
+int recover(void *state, const sha256_t* digest, const ec_signature_t& sig, ec_pubkey_t& key) {
+
+	context *p = (context*) state;
+	const EC_GROUP *group;
+	int recid;
 
-		ret = 0;
+	// Unserialize signature into r,s,recid components.
+	if (ECDSA_SIG_unserialize(sig.data(), p->r, p->s, &recid) == 0 || recid < 0 || recid > 3) {
+		return -1;
+	}
+
+	// Recover public key. secp256k1 has a cofactor of 1, every point of the curve has
+	// order n and the check that R * n is infinity can be skipped.
+	group = EC_KEY_get0_group(p->k);
+	if (ECDSA_SIG_recover_key_GFp(group, p->point, p->R, p->r, p->s, (const unsigned char*) digest, 32, recid, 0, p->ctx) != 1) {
+		return -1;
+	}
+
+	// Encode point to binary compressed format.
+	if (EC_POINT_encode(group, p->point, key.data(), EC_PUBKEY_SIZE, p->ctx) == 0) {
+		return -1;
 	}
 
-err4:	BN_free(s);
-err3:	BN_free(r);
-err2:   EC_KEY_free(ec_key);
-err1:	return ret;
+	return 0;
 }
 
-} // namespace libeosio
\ No newline at end of file
+}}} // namespace libeosio::internal::openssl
\ No newline at end of file
@@ -1,7 +1,7 @@
 /**
  * MIT License
  *
- * Copyright (c) 2019-2021 EOS Sw/eden
+ * Copyright (c) 2019-2023 EOS Sw/eden
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -21,23 +21,105 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include <openssl/sha.h>
-#include <openssl/ripemd.h>
+#include <openssl/evp.h>
+#include <openssl/opensslv.h>
 #include <libeosio/hash.hpp>
 
 namespace libeosio {
 
+namespace {
+
+// Digest implementations, looked up once per process. On OpenSSL 3 every implicit
+// lookup (SHA256(), EVP_sha256() passed to EVP_DigestInit_ex(), ...) goes through
+// the provider machinery, which costs more than hashing a public key.
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+struct digests {
+	EVP_MD *sha256;
+	EVP_MD *ripemd160; // NULL before 3.0.7 unless the legacy provider is loaded.
+
+	digests() :
+		sha256(EVP_MD_fetch(NULL, "SHA256", NULL)),
+		ripemd160(EVP_MD_fetch(NULL, "RIPEMD160", NULL)) {}
+
+	~digests() {
+		EVP_MD_free(sha256);
+		EVP_MD_free(ripemd160);
+	}
+};
+
+const digests& _digests() {
+	static const digests d;
+	return d;
+}
+
+const EVP_MD* _sha256_md() {
+	return _digests().sha256;
+}
+
+const EVP_MD* _ripemd160_md() {
+	return _digests().ripemd160;
+}
+#else
+const EVP_MD* _sha256_md() {
+	return EVP_sha256();
+}
+
+const EVP_MD* _ripemd160_md() {
+	return EVP_ripemd160();
+}
+#endif
+
+// One digest context per thread, reused for every call. Initializing a context
+// again with the digest it already has keeps the existing implementation state.
+struct md_ctx {
+	EVP_MD_CTX *ctx;
+
+	md_ctx() : ctx(EVP_MD_CTX_new()) {}
+
+	~md_ctx() {
+		EVP_MD_CTX_free(ctx);
+	}
+};
+
+bool _digest(const EVP_MD *md, const unsigned char *data, std::size_t len, unsigned char *out) {
+
+	static thread_local md_ctx c;
+
+	return md && c.ctx
+		&& EVP_DigestInit_ex(c.ctx, md, NULL)
+		&& EVP_DigestUpdate(c.ctx, data, len)
+		&& EVP_DigestFinal_ex(c.ctx, out, NULL);
+}
+
+} // namespace
+
+// If OpenSSL can't provide a digest the native implementation is used.
+
 sha256_t* sha256(const unsigned char *data, std::size_t len, sha256_t* out) {
-	return (sha256_t *) SHA256(data, len, (unsigned char*) out);
+
+	if (!_digest(_sha256_md(), data, len, *out)) {
+		sha256_ctx_t ctx;
+		sha256_init(&ctx);
+		sha256_update(&ctx, data, len);
+		sha256_final(&ctx, out);
+	}
+	return out;
 }
 
 sha256_t* sha256d(const unsigned char *data, std::size_t len, sha256_t* out) {
-	SHA256(data, len, (unsigned char*) out);
-	return (sha256_t *) SHA256((unsigned char*) out, 32, (unsigned char*) out);
+	sha256(data, len, out);
+	return sha256(*out, sizeof(*out), out);
 }
 
 ripemd160_t* ripemd160(const unsigned char *data, std::size_t len, ripemd160_t* out) {
-	return (ripemd160_t *) RIPEMD160(data, len, (unsigned char*) out);
+
+	if (!_digest(_ripemd160_md(), data, len, *out)) {
+		ripemd160_ctx_t ctx;
+		ripemd160_init(&ctx);
+		ripemd160_update(&ctx, data, len);
+		ripemd160_final(&ctx, out);
+	}
+	return out;
 }
 
 } // namespace libeosio
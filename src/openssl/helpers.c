@@ -24,78 +24,34 @@
 
 #include <openssl/ec.h>
 #include <openssl/bn.h>
-#include <string.h>
+#include <openssl/ecdsa.h>
 
-// Calcualte a public key from a EC_KEY object.
-int calculate_pubkey(const EC_GROUP *group, const EC_KEY *ec_key, EC_POINT **point) {
-	const BIGNUM* pk;
-
-	// Then get the private key number
-	if ((pk = EC_KEY_get0_private_key(ec_key)) == NULL) {
-		return 0;
-	}
-
-	// Create a new point.
-	if ((*point = EC_POINT_new(group)) == NULL) {
-		return 0;
-	}
-
-	// Multiply curve (group) and private key to get the public key.
-	return EC_POINT_mul(group, *point, pk, NULL, NULL, NULL);
-}
-
-int ECDSA_SIG_unserialize_rs(const unsigned char *sig, BIGNUM **r, BIGNUM **s, int *recid) {
+int ECDSA_SIG_unserialize(const unsigned char *sig, BIGNUM *r, BIGNUM *s, int *recid) {
 
 	*recid = sig[0] - 27 - 4;
 
-	if ((*r = BN_bin2bn(sig + 1, 32, NULL)) == NULL) {
-		return 0;
-	}
-
-	if ((*s = BN_bin2bn(sig + 33, 32, NULL)) == NULL) {
-		BN_free(*r);
+	if (BN_bin2bn(sig + 1, 32, r) == NULL || BN_bin2bn(sig + 33, 32, s) == NULL) {
 		return 0;
 	}
 	return 1;
 }
 
-int ECDSA_SIG_unserialize(const unsigned char *sig, ECDSA_SIG *ecdsa_sig, int *recid) {
-
-	BIGNUM *r, *s;
-
-	if (ECDSA_SIG_unserialize_rs(sig, &r, &s, recid) == 0) {
-		return 0;
-	}
-
-	if (ECDSA_SIG_set0(ecdsa_sig, r, s) == 0) {
-		BN_free(r);
-		BN_free(s);
-		return 0;
-	}
-
-	// r,s pointers are owned by ECDSA_SIG from this point.
-	// So we should not free them.
-	return 1;
-}
+// Canonical numbers are 248 to 255 bits, their DER encoding is exactly 32 bytes long.
+#define BN_is_canonical(n) (BN_num_bits(n) >= 248 && BN_num_bits(n) <= 255)
 
 int ECDSA_SIG_serialize(const ECDSA_SIG *ecdsa_sig, int recid, unsigned char* sig) {
 
-	unsigned char* der = NULL;
-	int bytes, ret = -1;
-	unsigned char lR, lS;
-
-	bytes = i2d_ECDSA_SIG( ecdsa_sig, &der );
-	lR = der[3];
-	lS = der[5+lR];
+	const BIGNUM *r = ECDSA_SIG_get0_r(ecdsa_sig);
+	const BIGNUM *s = ECDSA_SIG_get0_s(ecdsa_sig);
 
-	if (lR != 32 || lS != 32) goto err;
+	if (!BN_is_canonical(r) || !BN_is_canonical(s)) {
+		return -1;
+	}
 
-	memcpy(sig + 1, &der[4], 32);
-	memcpy(sig + 33, &der[6+32], 32);
+	if (BN_bn2binpad(r, sig + 1, 32) != 32 || BN_bn2binpad(s, sig + 33, 32) != 32) {
+		return -1;
+	}
 	sig[0] = recid + 27 + 4;
 
-	ret = 0;
-err:
-	free(der);
-	return ret;
-}
\ No newline at end of file
+	return 0;
+}
@@ -36,27 +36,27 @@
 extern "C" {
 #endif
 
-int calculate_pubkey(const EC_GROUP *group, const EC_KEY *ec_key, EC_POINT **point);
-
-int ECDSA_SIG_recover_key_GFp(EC_KEY *eckey, const BIGNUM* r, const BIGNUM* s, const unsigned char *msg, int msglen, int recid, int check);
+/**
+ * Recovers the public key of signature `r`, `s` with recovery id `recid` into `Q`.
+ * `R` is a scratch point. Returns 1 on success, 0 or a negative number otherwise.
+ */
+int ECDSA_SIG_recover_key_GFp(const EC_GROUP *group, EC_POINT *Q, EC_POINT *R, const BIGNUM* r, const BIGNUM* s, const unsigned char *msg, int msglen, int recid, int check, BN_CTX *ctx);
 
 /**
  * Signature serialization function.
  * sig must be a pointer to a serialized signature and be atleast 65 (32s + 32 + 1) bytes long.
  *
- * returns -1 if there was an error. zero otherwise.
+ * returns -1 if there was an error or the signature is not canonical. zero otherwise.
  */
 int ECDSA_SIG_serialize(const ECDSA_SIG *ecdsa_sig, int recid, unsigned char* sig);
 
 /**
- * Signature unserialization functions.
+ * Signature unserialization function, loads r and s into existing numbers.
  * sig must be a pointer to a serialized signature and be atleast 65 (32s + 32 + 1) bytes long.
  *
- * returns -1 if there was an error. zero otherwise.
+ * returns 0 if there was an error. one otherwise.
  */
-int ECDSA_SIG_unserialize(const unsigned char *sig, ECDSA_SIG *ecdsa_sig, int *recid);
-
-int ECDSA_SIG_unserialize_rs(const unsigned char *sig, BIGNUM **r, BIGNUM **s, int *recid);
+int ECDSA_SIG_unserialize(const unsigned char *sig, BIGNUM *r, BIGNUM *s, int *recid);
 
 #ifdef __cplusplus
 }
@@ -6,12 +6,12 @@
 #include <openssl/ec.h>
 #include <openssl/bn.h>
 
-int ECDSA_SIG_recover_key_GFp(EC_KEY *eckey, const BIGNUM* r, const BIGNUM* s, const unsigned char *msg, int msglen, int recid, int check)
+// Modified to use the caller's BN_CTX and points, the key is returned in `Q`.
+int ECDSA_SIG_recover_key_GFp(const EC_GROUP *group, EC_POINT *Q, EC_POINT *R, const BIGNUM* r, const BIGNUM* s, const unsigned char *msg, int msglen, int recid, int check, BN_CTX *ctx)
 {
-	if (!eckey) return 0;
+	if (!group || !ctx) return 0;
 
 	int ret = 0;
-	BN_CTX *ctx = NULL;
 
 	BIGNUM *x = NULL;
 	BIGNUM *e = NULL;
@@ -19,16 +19,11 @@ int ECDSA_SIG_recover_key_GFp(EC_KEY *eckey, const BIGNUM* r, const BIGNUM* s, c
 	BIGNUM *sor = NULL;
 	BIGNUM *eor = NULL;
 	BIGNUM *field = NULL;
-	EC_POINT *R = NULL;
-	EC_POINT *O = NULL;
-	EC_POINT *Q = NULL;
 	BIGNUM *rr = NULL;
 	BIGNUM *zero = NULL;
 	int n = 0;
 	int i = recid / 2;
 
-	const EC_GROUP *group = EC_KEY_get0_group(eckey);
-	if ((ctx = BN_CTX_new()) == NULL) { ret = -1; goto err; }
 	BN_CTX_start(ctx);
 	order = BN_CTX_get(ctx);
 	if (!EC_GROUP_get_order(group, order, ctx)) { ret = -2; goto err; }
@@ -39,15 +34,12 @@ int ECDSA_SIG_recover_key_GFp(EC_KEY *eckey, const BIGNUM* r, const BIGNUM* s, c
 	field = BN_CTX_get(ctx);
 	if (!EC_GROUP_get_curve_GFp(group, field, NULL, NULL, ctx)) { ret=-2; goto err; }
 	if (BN_cmp(x, field) >= 0) { ret=0; goto err; }
-	if ((R = EC_POINT_new(group)) == NULL) { ret = -2; goto err; }
 	if (!EC_POINT_set_compressed_coordinates_GFp(group, R, x, recid % 2, ctx)) { ret=0; goto err; }
 	if (check)
 	{
-		if ((O = EC_POINT_new(group)) == NULL) { ret = -2; goto err; }
-		if (!EC_POINT_mul(group, O, NULL, R, order, ctx)) { ret=-2; goto err; }
-		if (!EC_POINT_is_at_infinity(group, O)) { ret = 0; goto err; }
+		if (!EC_POINT_mul(group, Q, NULL, R, order, ctx)) { ret=-2; goto err; }
+		if (!EC_POINT_is_at_infinity(group, Q)) { ret = 0; goto err; }
 	}
-	if ((Q = EC_POINT_new(group)) == NULL) { ret = -2; goto err; }
 	n = EC_GROUP_get_degree(group);
 	e = BN_CTX_get(ctx);
 	if (!BN_bin2bn(msg, msglen, e)) { ret=-1; goto err; }
@@ -62,18 +54,11 @@ int ECDSA_SIG_recover_key_GFp(EC_KEY *eckey, const BIGNUM* r, const BIGNUM* s, c
 	eor = BN_CTX_get(ctx);
 	if (!BN_mod_mul(eor, e, rr, order, ctx)) { ret=-1; goto err; }
 	if (!EC_POINT_mul(group, Q, eor, R, sor, ctx)) { ret=-2; goto err; }
-	if (!EC_KEY_set_public_key(eckey, Q)) { ret=-2; goto err; }
 
 	ret = 1;
 
 err:
-	if (ctx) {
-		BN_CTX_end(ctx);
-		BN_CTX_free(ctx);
-	}
-	if (R != NULL) EC_POINT_free(R);
-	if (O != NULL) EC_POINT_free(O);
-	if (Q != NULL) EC_POINT_free(Q);
+	BN_CTX_end(ctx);
 	return ret;
 }
 
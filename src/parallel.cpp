@@ -0,0 +1,198 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <unistd.h>
+	#if defined(__linux__)
+		#include <pthread.h>
+		#include <sched.h>
+	#endif
+#endif
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "parallel.hpp"
+
+namespace libeosio { namespace internal {
+
+bool pin_thread(unsigned int cpu) {
+#if defined(_WIN32)
+	DWORD_PTR process, system, m;
+	unsigned int count = 0;
+
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &process, &system) || process == 0) {
+		return false;
+	}
+
+	for (m = process; m; m &= m - 1) {
+		count++;
+	}
+
+	// Keep the lowest set bit after clearing `cpu % count` of them.
+	for (count = cpu % count; count > 0; count--) {
+		process &= process - 1;
+	}
+	return SetThreadAffinityMask(GetCurrentThread(), process & (~process + 1)) != 0;
+#elif defined(__linux__)
+	cpu_set_t allowed, set;
+	int count, n;
+
+	// Containers and taskset often restrict the process to some of the cpus.
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || (count = CPU_COUNT(&allowed)) == 0) {
+		return false;
+	}
+
+	n = cpu % count;
+	for (int i = 0; i < CPU_SETSIZE; i++) {
+		if (CPU_ISSET(i, &allowed) && n-- == 0) {
+			CPU_ZERO(&set);
+			CPU_SET(i, &set);
+			return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+		}
+	}
+	return false;
+#else
+	(void) cpu;
+	return false;
+#endif
+}
+
+namespace {
+
+struct pool_job {
+	const std::function<void(std::size_t)> *fn;
+	// Calls not yet done, guarded by the pool mutex.
+	std::size_t remaining;
+};
+
+struct pool_task {
+	pool_job *job;
+	std::size_t i;
+};
+
+class thread_pool {
+public:
+#if !defined(_WIN32)
+	thread_pool() : owner(getpid()) {}
+
+	// Process that started the workers, they do not exist in a fork()'ed child.
+	const pid_t owner;
+#endif
+
+	void run(std::size_t n, const std::function<void(std::size_t)>& fn) {
+
+		pool_job job = { &fn, n - 1 };
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (workers.size() < n - 1) {
+			workers.push_back(std::thread(&thread_pool::_worker, this));
+		}
+
+		for (std::size_t i = 0; i + 1 < n; i++) {
+			pool_task t = { &job, i };
+			queue.push_back(t);
+		}
+		work.notify_all();
+
+		lock.unlock();
+		fn(n - 1);
+		lock.lock();
+
+		while (job.remaining > 0) {
+			if (!queue.empty()) {
+				_run_next(lock);
+			} else {
+				done.wait(lock);
+			}
+		}
+	}
+
+private:
+	// Runs the first queued task, `lock` is held on entry and exit.
+	void _run_next(std::unique_lock<std::mutex>& lock) {
+
+		pool_task t = queue.front();
+		queue.pop_front();
+
+		lock.unlock();
+		(*t.job->fn)(t.i);
+		lock.lock();
+
+		if (--t.job->remaining == 0) {
+			done.notify_all();
+		}
+	}
+
+	void _worker() {
+		std::unique_lock<std::mutex> lock(mutex);
+
+		for (;;) {
+			work.wait(lock, [this]() { return !queue.empty(); });
+			_run_next(lock);
+		}
+	}
+
+	std::mutex mutex;
+	std::condition_variable work;
+	std::condition_variable done;
+	std::deque<pool_task> queue;
+	std::vector<std::thread> workers;
+};
+
+std::mutex _pool_mutex;
+thread_pool *_pool = NULL;
+
+} // namespace
+
+void parallel_run(std::size_t n, const std::function<void(std::size_t)>& fn) {
+
+	thread_pool *pool;
+
+	if (n == 1) {
+		fn(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_pool_mutex);
+
+		// The pool is never destroyed: idle workers are left blocked when the process
+		// exits rather than tearing down their contexts while other static state may
+		// already be gone. A fork()'ed child gets a new pool.
+#if defined(_WIN32)
+		if (_pool == NULL) {
+#else
+		if (_pool == NULL || _pool->owner != getpid()) {
+#endif
+			_pool = new thread_pool();
+		}
+		pool = _pool;
+	}
+
+	pool->run(n, fn);
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_PARALLEL_H
+#define LIBEOSIO_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Returns the number of threads to use when the caller asked for `threads` (0 = one per cpu).
+ */
+inline unsigned int parallel_threads(unsigned int threads) {
+	if (threads == 0) {
+		threads = std::thread::hardware_concurrency();
+	}
+	return threads > 0 ? threads : 1;
+}
+
+/**
+ * Pin the calling thread to the `cpu`:th cpu (modulo the number of cpus) the process
+ * is allowed to run on. Returns false if the platform does not support it.
+ */
+bool pin_thread(unsigned int cpu);
+
+/**
+ * Calls `fn(i)` for every `i` in [0, n) and returns when all calls are done.
+ *
+ * The first n - 1 calls are run by a process wide pool of worker threads, the last
+ * one on the calling thread. Workers are started on first use and kept for the life
+ * of the process, so per-thread state (like the default ec_context) outlives a call.
+ * A caller that waits runs queued calls itself, so nested use can not deadlock.
+ */
+void parallel_run(std::size_t n, const std::function<void(std::size_t)>& fn);
+
+template <typename F>
+void parallel_for(std::size_t n, F fn) {
+	if (n > 0) {
+		parallel_run(n, std::function<void(std::size_t)>(fn));
+	}
+}
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_PARALLEL_H */
@@ -0,0 +1,637 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <libeosio/vanity.hpp>
+#include "parallel.hpp"
+#include "vanity/checkpoint.hpp"
+
+namespace libeosio {
+
+typedef std::chrono::steady_clock _clock;
+
+using internal::vanity_range;
+
+namespace {
+
+// Per worker buffers of the matcher.
+struct scratch {
+	std::vector<ec_pubkey_t> pubs;
+	std::vector<char> strs;
+};
+
+// Checks keys against the patterns.
+class matcher {
+public:
+	/**
+	 * Returns false if a pattern can never match.
+	 */
+	bool compile(const std::vector<vanity_pattern_t>& patterns, const wif_codec_t& codec) {
+
+		_patterns = patterns;
+		_prefix = codec.pub;
+		_stride = wif_pub_encoded_size(_prefix);
+		_ranges.assign(patterns.size(), std::vector<wif_pub_range_t>());
+		_ranges_only = true;
+
+		if (!_strings.compile(patterns)) {
+			return false;
+		}
+
+		for (std::size_t i = 0; i < patterns.size(); i++) {
+			if (patterns[i].position != VANITY_PREFIX || patterns[i].flags != 0) {
+				_ranges_only = false;
+			}
+			// Also rejects prefixes no key can start with.
+			else if (!wif_pub_prefix_ranges(patterns[i].text, _ranges[i]) || _ranges[i].empty()) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Calls `found(i, pattern, pub)` for every key in `pairs` that matches, with the index
+	 * of the first pattern it matches and the encoded public key.
+	 */
+	template <typename F>
+	void scan(const struct ec_keypair* pairs, std::size_t n, scratch& s, F found) const {
+		if (_ranges_only) {
+			_scan_ranges(pairs, n, found);
+		} else {
+			_scan_strings(pairs, n, s, found);
+		}
+	}
+
+private:
+	// Only exact prefixes: compare the raw keys with the ranges and encode the hits.
+	template <typename F>
+	void _scan_ranges(const struct ec_keypair* pairs, std::size_t n, F found) const {
+		for (std::size_t i = 0; i < n; i++) {
+			const ec_pubkey_t& pub = pairs[i].pub;
+
+			for (std::size_t j = 0; j < _patterns.size(); j++) {
+				if (!_in_ranges(pub, _ranges[j])) {
+					continue;
+				}
+
+				// The first and last key of a range depend on their checksum.
+				std::string str = wif_pub_encode(pub, _prefix);
+				if (str.compare(_prefix.size(), _patterns[j].text.size(), _patterns[j].text) == 0) {
+					found(i, j, str);
+					break;
+				}
+			}
+		}
+	}
+
+	template <typename F>
+	void _scan_strings(const struct ec_keypair* pairs, std::size_t n, scratch& s, F found) const {
+
+		s.pubs.resize(n);
+		s.strs.resize(n * _stride);
+
+		for (std::size_t i = 0; i < n; i++) {
+			s.pubs[i] = pairs[i].pub;
+		}
+
+		wif_pub_encode_batch(s.pubs.data(), n, s.strs.data(), _stride, _prefix);
+
+		for (std::size_t i = 0; i < n; i++) {
+			const char *str = s.strs.data() + i * _stride;
+			std::size_t len = std::strlen(str + _prefix.size());
+			int j = _strings.match(str + _prefix.size(), len);
+
+			if (j >= 0) {
+				found(i, (std::size_t) j, std::string(str, _prefix.size() + len));
+			}
+		}
+	}
+
+	static bool _in_ranges(const ec_pubkey_t& pub, const std::vector<wif_pub_range_t>& ranges) {
+		for (std::size_t i = 0; i < ranges.size(); i++) {
+			if (ranges[i].first <= pub && pub <= ranges[i].last) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::vector<vanity_pattern_t> _patterns;
+	std::vector<std::vector<wif_pub_range_t> > _ranges;
+	vanity_matcher _strings;
+	std::string _prefix;
+	std::size_t _stride;
+	bool _ranges_only;
+};
+
+} // namespace
+
+struct vanity_search::impl {
+	// Settings
+	std::vector<vanity_pattern_t> patterns;
+	wif_codec_t codec;
+	unsigned int threads;
+	bool pin;
+	bool has_base;
+	ec_privkey_t base;
+	uint64_t max_keys;
+	uint64_t max_matches;
+	double timeout;
+	match_fn match_cb;
+	progress_fn progress_cb;
+	double interval;
+	std::string checkpoint;
+	double checkpoint_interval;
+
+	// Progress through the sequence, kept between runs and saved in checkpoints.
+	// Chunks are handed out and finished under `chunk_mutex` (once per chunk), so a
+	// checkpoint always sees every key either done, in progress or not started.
+	mutable std::mutex chunk_mutex;
+	uint64_t next_key;
+	std::vector<vanity_range> pending;   // Below next_key but not done, last first.
+	std::vector<vanity_range> cursors;   // Chunk of each worker, count is 0 if idle.
+	std::atomic<uint64_t> keys;          // Keys in finished chunks.
+
+	// Found keys, `match_mutex` also serializes the match callback (recursive, so the
+	// callback can call matches() or save_checkpoint()).
+	mutable std::recursive_mutex match_mutex;
+	std::vector<vanity_match_t> results;
+	std::set<uint64_t> found;        // Index of every result.
+	std::atomic<uint64_t> matches;
+
+	// State of a run.
+	matcher m;
+	std::atomic<bool> stop;
+	unsigned int workers;
+
+	// Guards active, error, running and the stats below, `cond` is signaled when
+	// the search should stop or a worker exits.
+	mutable std::mutex mutex;
+	std::condition_variable cond;
+	unsigned int active;
+	bool error;
+	bool running;
+	_clock::time_point start;
+	double seconds;                  // Of the earlier runs.
+	double kps;
+
+	void halt(bool failed = false) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+			error = error || failed;
+		}
+		cond.notify_all();
+	}
+
+	void reset() {
+		next_key = 0;
+		pending.clear();
+		keys = 0;
+		for (std::size_t i = 0; i < results.size(); i++) {
+			std::memset(results[i].key.secret.data(), 0, results[i].key.secret.size());
+		}
+		results.clear();
+		found.clear();
+		matches = 0;
+		seconds = 0;
+	}
+};
+
+static void _found(vanity_search::impl *p, const struct ec_keypair& pair, std::size_t pattern,
+	uint64_t index, const std::string& pub) {
+
+	std::lock_guard<std::recursive_mutex> lock(p->match_mutex);
+	vanity_match_t m;
+
+	// Nothing is reported once the search has stopped (eg. max_matches was reached),
+	// or twice when a chunk is searched again.
+	if (p->stop || !p->found.insert(index).second) {
+		return;
+	}
+
+	m.key = pair;
+	m.pub = pub;
+	m.pattern = pattern;
+	m.index = index;
+
+	p->results.push_back(m);
+	p->matches++;
+
+	if (p->max_matches && p->matches >= p->max_matches) {
+		p->halt();
+	}
+
+	if (p->match_cb && !p->match_cb(m)) {
+		p->halt();
+	}
+
+	std::memset(m.key.secret.data(), 0, m.key.secret.size());
+}
+
+static bool _last_first(const vanity_range& a, const vanity_range& b) {
+	return a.first > b.first;
+}
+
+// Take the next chunk for worker `id`, pending keys first. Returns false when there is
+// nothing left to search.
+static bool _claim(vanity_search::impl *p, unsigned int id, vanity_range& chunk) {
+
+	std::lock_guard<std::mutex> lock(p->chunk_mutex);
+	bool again = !p->pending.empty();
+
+	chunk.first = again ? p->pending.back().first : p->next_key;
+	chunk.count = again ? std::min<uint64_t>(p->pending.back().count, VANITY_CHUNK_KEYS) : VANITY_CHUNK_KEYS;
+
+	if (p->max_keys) {
+		if (chunk.first >= p->max_keys) {
+			return false;
+		}
+		chunk.count = std::min(chunk.count, p->max_keys - chunk.first);
+	}
+
+	if (!again) {
+		p->next_key += chunk.count;
+	} else if ((p->pending.back().count -= chunk.count) == 0) {
+		p->pending.pop_back();
+	} else {
+		p->pending.back().first += chunk.count;
+	}
+
+	p->cursors[id] = chunk;
+	return true;
+}
+
+// Chunks that were not searched to the end are put back.
+static void _finish(vanity_search::impl *p, unsigned int id, const vanity_range& chunk, bool done) {
+
+	std::lock_guard<std::mutex> lock(p->chunk_mutex);
+
+	if (done) {
+		p->keys += chunk.count;
+	} else {
+		p->pending.push_back(chunk);
+		std::sort(p->pending.begin(), p->pending.end(), _last_first);
+	}
+	p->cursors[id].count = 0;
+}
+
+static void _worker(vanity_search::impl *p, unsigned int id) {
+
+	ec_context ctx;
+	std::vector<struct ec_keypair> pairs(VANITY_CHUNK_KEYS);
+	scratch s;
+	vanity_range chunk;
+
+	if (p->pin) {
+		internal::pin_thread(id);
+	}
+
+	if (!ctx.valid()) {
+		p->halt(true);
+	}
+
+	while (!p->stop.load(std::memory_order_relaxed) && _claim(p, id, chunk)) {
+		std::size_t n = (std::size_t) chunk.count;
+
+		if (ctx.derive_keys_sequential(p->base, chunk.first, pairs.data(), n) < 0) {
+			_finish(p, id, chunk, false);
+			p->halt(true);
+			break;
+		}
+
+		p->m.scan(pairs.data(), n, s, [&](std::size_t i, std::size_t pattern, const std::string& pub) {
+			_found(p, pairs[i], pattern, chunk.first + i, pub);
+		});
+
+		// Matches after the stop were not reported.
+		_finish(p, id, chunk, !p->stop.load(std::memory_order_relaxed));
+	}
+
+	std::memset(pairs.data(), 0, pairs.size() * sizeof(struct ec_keypair));
+
+	{
+		std::lock_guard<std::mutex> lock(p->mutex);
+		p->active--;
+	}
+	p->cond.notify_all();
+}
+
+static _clock::duration _seconds(double s) {
+	return std::chrono::duration_cast<_clock::duration>(std::chrono::duration<double>(s));
+}
+
+vanity_search::vanity_search(const std::vector<vanity_pattern_t>& patterns, const wif_codec_t& codec) : p(new impl()) {
+	p->patterns = patterns;
+	p->codec = codec;
+	p->threads = 0;
+	p->pin = true;
+	p->has_base = false;
+	p->max_keys = 0;
+	p->max_matches = 0;
+	p->timeout = 0;
+	p->interval = 1.0;
+	p->checkpoint_interval = 60.0;
+	p->stop = false;
+	p->workers = 0;
+	p->active = 0;
+	p->error = false;
+	p->running = false;
+	p->kps = 0;
+	p->reset();
+}
+
+vanity_search::~vanity_search() {
+	p->reset();
+	std::memset(p->base.data(), 0, p->base.size());
+	delete p;
+}
+
+void vanity_search::set_threads(unsigned int threads) {
+	p->threads = threads;
+}
+
+void vanity_search::set_pin_threads(bool pin) {
+	p->pin = pin;
+}
+
+void vanity_search::set_base(const ec_privkey_t& base) {
+	p->reset();
+	p->base = base;
+	p->has_base = true;
+}
+
+void vanity_search::set_max_keys(uint64_t keys) {
+	p->max_keys = keys;
+}
+
+void vanity_search::set_max_matches(uint64_t matches) {
+	p->max_matches = matches;
+}
+
+void vanity_search::set_timeout(double seconds) {
+	p->timeout = seconds;
+}
+
+void vanity_search::on_match(match_fn fn) {
+	p->match_cb = fn;
+}
+
+void vanity_search::on_progress(progress_fn fn, double interval) {
+	p->progress_cb = fn;
+	p->interval = interval > 0 ? interval : 1.0;
+}
+
+void vanity_search::set_checkpoint(const std::string& filename, double interval) {
+	p->checkpoint = filename;
+	p->checkpoint_interval = interval > 0 ? interval : 60.0;
+}
+
+int vanity_search::run() {
+
+	std::vector<std::thread> pool;
+	uint64_t last_keys;
+	bool saved = true;
+
+	if (!p->m.compile(p->patterns, p->codec)) {
+		return -1;
+	}
+
+	if (!p->has_base) {
+		if (ec_generate_privkey(&p->base) < 0) {
+			return -1;
+		}
+		p->has_base = true;
+	}
+
+	p->workers = internal::parallel_threads(p->threads);
+	p->cursors.assign(p->workers, vanity_range());
+	p->stop = false;
+	last_keys = p->keys;
+
+	std::unique_lock<std::mutex> lock(p->mutex);
+
+	p->active = p->workers;
+	p->error = false;
+	p->running = true;
+	p->kps = 0;
+	p->start = _clock::now();
+
+	_clock::time_point last = p->start;
+	_clock::time_point report = p->start + _seconds(p->interval);
+	_clock::time_point save = p->start + _seconds(p->checkpoint_interval);
+	_clock::time_point deadline = p->start + _seconds(p->timeout);
+
+	for (unsigned int i = 0; i < p->workers; i++) {
+		pool.push_back(std::thread(_worker, p, i));
+	}
+
+	while (!p->stop && p->active > 0) {
+
+		_clock::time_point wake = _clock::time_point::max();
+		if (p->progress_cb) {
+			wake = report;
+		}
+		if (!p->checkpoint.empty()) {
+			wake = std::min(wake, save);
+		}
+		if (p->timeout > 0) {
+			wake = std::min(wake, deadline);
+		}
+
+		if (wake == _clock::time_point::max()) {
+			p->cond.wait(lock);
+		} else {
+			p->cond.wait_until(lock, wake);
+		}
+
+		_clock::time_point now = _clock::now();
+
+		if (p->timeout > 0 && now >= deadline) {
+			break;
+		}
+
+		// Callbacks and saving take the locks themselves.
+		if (p->progress_cb && now >= report) {
+			uint64_t keys = p->keys;
+
+			p->kps = (keys - last_keys) / std::chrono::duration<double>(now - last).count();
+			last_keys = keys;
+			last = now;
+			report = now + _seconds(p->interval);
+
+			lock.unlock();
+			p->progress_cb(stats());
+			lock.lock();
+		}
+
+		if (!p->checkpoint.empty() && now >= save) {
+			save = now + _seconds(p->checkpoint_interval);
+
+			lock.unlock();
+			saved = save_checkpoint(p->checkpoint) == 0 && saved;
+			lock.lock();
+		}
+	}
+
+	p->stop = true;
+	lock.unlock();
+	p->cond.notify_all();
+
+	for (std::size_t i = 0; i < pool.size(); i++) {
+		pool[i].join();
+	}
+
+	lock.lock();
+	p->running = false;
+	double elapsed = std::chrono::duration<double>(_clock::now() - p->start).count();
+	p->seconds += elapsed;
+	p->kps = elapsed > 0 ? (p->keys - last_keys) / elapsed : 0;
+	lock.unlock();
+
+	if (!p->checkpoint.empty()) {
+		saved = save_checkpoint(p->checkpoint) == 0 && saved;
+	}
+
+	return p->error || !saved ? -1 : 0;
+}
+
+void vanity_search::cancel() {
+	p->halt();
+}
+
+vanity_stats_t vanity_search::stats() const {
+
+	std::lock_guard<std::mutex> lock(p->mutex);
+	vanity_stats_t st;
+
+	st.matches = p->matches;
+	st.keys = p->keys;
+	st.seconds = p->seconds;
+	if (p->running) {
+		st.seconds += std::chrono::duration<double>(_clock::now() - p->start).count();
+	}
+	st.kps = p->kps;
+
+	return st;
+}
+
+std::vector<vanity_match_t> vanity_search::matches() const {
+	std::lock_guard<std::recursive_mutex> lock(p->match_mutex);
+	return p->results;
+}
+
+const ec_privkey_t& vanity_search::base() const {
+	return p->base;
+}
+
+int vanity_search::save_checkpoint(const std::string& filename) const {
+
+	internal::vanity_checkpoint cp;
+	int rc;
+
+	cp.base = p->base;
+	cp.prefix = p->codec.pub;
+	cp.patterns = p->patterns;
+
+	// Chunks first: matches of a chunk are stored before it is finished.
+	{
+		std::lock_guard<std::mutex> lock(p->chunk_mutex);
+
+		cp.next_key = p->next_key;
+		cp.pending = p->pending;
+		cp.keys = p->keys;
+		for (std::size_t i = 0; i < p->cursors.size(); i++) {
+			if (p->cursors[i].count > 0) {
+				cp.pending.push_back(p->cursors[i]);
+			}
+		}
+	}
+
+	cp.matches = matches();
+	cp.seconds = stats().seconds;
+
+	rc = internal::vanity_checkpoint_write(filename, cp);
+
+	for (std::size_t i = 0; i < cp.matches.size(); i++) {
+		std::memset(cp.matches[i].key.secret.data(), 0, cp.matches[i].key.secret.size());
+	}
+	std::memset(cp.base.data(), 0, cp.base.size());
+
+	return rc;
+}
+
+int vanity_search::load_checkpoint(const std::string& filename) {
+
+	internal::vanity_checkpoint cp;
+	int rc = -1;
+
+	if (internal::vanity_checkpoint_read(filename, cp) < 0) {
+		goto out;
+	}
+
+	if (cp.prefix != p->codec.pub || cp.patterns.size() != p->patterns.size()) {
+		goto out;
+	}
+
+	for (std::size_t i = 0; i < cp.patterns.size(); i++) {
+		if (cp.patterns[i].text != p->patterns[i].text
+			|| cp.patterns[i].position != p->patterns[i].position
+			|| cp.patterns[i].flags != p->patterns[i].flags) {
+			goto out;
+		}
+	}
+
+	set_base(cp.base);
+
+	p->next_key = cp.next_key;
+	p->pending = cp.pending;
+	std::sort(p->pending.begin(), p->pending.end(), _last_first);
+	p->keys = cp.keys;
+	p->seconds = cp.seconds;
+	p->results = cp.matches;
+	for (std::size_t i = 0; i < cp.matches.size(); i++) {
+		p->found.insert(cp.matches[i].index);
+	}
+	p->matches = cp.matches.size();
+	rc = 0;
+
+out:
+	for (std::size_t i = 0; i < cp.matches.size(); i++) {
+		std::memset(cp.matches[i].key.secret.data(), 0, cp.matches[i].key.secret.size());
+	}
+	std::memset(cp.base.data(), 0, cp.base.size());
+	return rc;
+}
+
+} // namespace libeosio
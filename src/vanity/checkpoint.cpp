@@ -0,0 +1,313 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <libeosio/checksum.hpp>
+#include <libeosio/WIF.hpp>
+#include "checkpoint.hpp"
+#include "../file_map.hpp"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace libeosio { namespace internal {
+
+#define CHECKPOINT_MAGIC "EOSVANCP"
+#define CHECKPOINT_VERSION 1
+
+namespace {
+
+class writer {
+public:
+	void u8(uint8_t v) {
+		buf.push_back((char) v);
+	}
+
+	void u32(uint32_t v) {
+		for (int i = 0; i < 4; i++) {
+			u8((uint8_t) (v >> (i * 8)));
+		}
+	}
+
+	void u64(uint64_t v) {
+		for (int i = 0; i < 8; i++) {
+			u8((uint8_t) (v >> (i * 8)));
+		}
+	}
+
+	void bytes(const unsigned char* data, std::size_t len) {
+		buf.append((const char*) data, len);
+	}
+
+	void str(const std::string& s) {
+		u32((uint32_t) s.size());
+		buf.append(s);
+	}
+
+	std::string buf;
+};
+
+class reader {
+public:
+	reader(const char* data, std::size_t size) : p(data), end(data + size), ok(true) {
+	}
+
+	uint8_t u8() {
+		if (!_need(1)) {
+			return 0;
+		}
+		return (uint8_t) *p++;
+	}
+
+	uint32_t u32() {
+		uint32_t v = 0;
+		for (int i = 0; i < 4; i++) {
+			v |= (uint32_t) u8() << (i * 8);
+		}
+		return v;
+	}
+
+	uint64_t u64() {
+		uint64_t v = 0;
+		for (int i = 0; i < 8; i++) {
+			v |= (uint64_t) u8() << (i * 8);
+		}
+		return v;
+	}
+
+	void bytes(unsigned char* out, std::size_t len) {
+		if (_need(len)) {
+			std::memcpy(out, p, len);
+			p += len;
+		}
+	}
+
+	std::string str() {
+		std::size_t len = u32();
+		if (!_need(len)) {
+			return std::string();
+		}
+		p += len;
+		return std::string(p - len, len);
+	}
+
+	// Counts are checked against the remaining input, so a corrupt count can not
+	// make the caller allocate gigabytes.
+	uint32_t count(std::size_t min_size) {
+		uint32_t n = u32();
+		if ((std::size_t) (end - p) / min_size < n) {
+			ok = false;
+			return 0;
+		}
+		return n;
+	}
+
+	const char* p;
+	const char* end;
+	bool ok;
+
+private:
+	bool _need(std::size_t len) {
+		if (!ok || (std::size_t) (end - p) < len) {
+			ok = false;
+			return false;
+		}
+		return true;
+	}
+};
+
+} // namespace
+
+// Create `filename` readable by the owner only, the checkpoint holds private keys.
+static std::FILE* _create(const std::string& filename) {
+#if defined(_WIN32)
+	return std::fopen(filename.c_str(), "wb");
+#else
+	std::FILE* f;
+	int fd;
+
+	// A file left by an earlier attempt would keep its mode, open() only sets it on creation.
+	if (::unlink(filename.c_str()) != 0 && errno != ENOENT) {
+		return NULL;
+	}
+	if ((fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0600)) < 0) {
+		return NULL;
+	}
+	if ((f = fdopen(fd, "wb")) == NULL) {
+		::close(fd);
+	}
+	return f;
+#endif
+}
+
+// Flush the directory entry of `filename`, the rename is not durable before.
+static int _sync_dir(const std::string& filename) {
+#if defined(_WIN32)
+	(void) filename;
+	return 0;
+#else
+	std::size_t slash = filename.rfind('/');
+	std::string dir = slash == std::string::npos ? "." : filename.substr(0, slash + 1);
+	int fd = ::open(dir.c_str(), O_RDONLY);
+	int ret;
+
+	if (fd < 0) {
+		return -1;
+	}
+	ret = fsync(fd);
+	::close(fd);
+	return ret == 0 ? 0 : -1;
+#endif
+}
+
+int vanity_checkpoint_write(const std::string& filename, const vanity_checkpoint& cp) {
+
+	std::string tmp = filename + ".tmp";
+	checksum_t crc;
+	writer w;
+	std::FILE* f;
+	bool ok;
+
+	w.buf.append(CHECKPOINT_MAGIC, 8);
+	w.u32(CHECKPOINT_VERSION);
+	w.bytes(cp.base.data(), cp.base.size());
+	w.str(cp.prefix);
+
+	w.u32((uint32_t) cp.patterns.size());
+	for (std::size_t i = 0; i < cp.patterns.size(); i++) {
+		w.u8((uint8_t) cp.patterns[i].position);
+		w.u8((uint8_t) cp.patterns[i].flags);
+		w.str(cp.patterns[i].text);
+	}
+
+	w.u64(cp.next_key);
+	w.u32((uint32_t) cp.pending.size());
+	for (std::size_t i = 0; i < cp.pending.size(); i++) {
+		w.u64(cp.pending[i].first);
+		w.u64(cp.pending[i].count);
+	}
+
+	w.u64(cp.keys);
+	w.u64((uint64_t) (cp.seconds * 1000));
+
+	w.u32((uint32_t) cp.matches.size());
+	for (std::size_t i = 0; i < cp.matches.size(); i++) {
+		const vanity_match_t& m = cp.matches[i];
+		w.bytes(m.key.secret.data(), m.key.secret.size());
+		w.bytes(m.key.pub.data(), m.key.pub.size());
+		w.u32((uint32_t) m.pattern);
+		w.u64(m.index);
+	}
+
+	checksum_sha256d((const unsigned char*) w.buf.data(), w.buf.size(), crc);
+	w.bytes(crc, CHECKSUM_SIZE);
+
+	if ((f = _create(tmp)) == NULL) {
+		std::memset(&w.buf[0], 0, w.buf.size());
+		return -1;
+	}
+
+	ok = std::fwrite(w.buf.data(), 1, w.buf.size(), f) == w.buf.size();
+	ok = std::fflush(f) == 0 && ok;
+#if !defined(_WIN32)
+	ok = fsync(fileno(f)) == 0 && ok;
+#endif
+	ok = std::fclose(f) == 0 && ok;
+
+	std::memset(&w.buf[0], 0, w.buf.size());
+
+#if defined(_WIN32)
+	// rename() does not replace existing files on windows.
+	if (ok) {
+		std::remove(filename.c_str());
+	}
+#endif
+
+	if (!ok || std::rename(tmp.c_str(), filename.c_str()) != 0) {
+		std::remove(tmp.c_str());
+		return -1;
+	}
+
+	return _sync_dir(filename);
+}
+
+int vanity_checkpoint_read(const std::string& filename, vanity_checkpoint& cp) {
+
+	file_map file;
+
+	if (file.open(filename) < 0 || file.size() < 8 + CHECKSUM_SIZE) {
+		return -1;
+	}
+
+	if (std::memcmp(file.data(), CHECKPOINT_MAGIC, 8) != 0
+		|| !checksum_validate<checksum_sha256d>((const unsigned char*) file.data(), file.size())) {
+		return -1;
+	}
+
+	reader r(file.data() + 8, file.size() - 8 - CHECKSUM_SIZE);
+
+	if (r.u32() != CHECKPOINT_VERSION) {
+		return -1;
+	}
+
+	r.bytes(cp.base.data(), cp.base.size());
+	cp.prefix = r.str();
+
+	cp.patterns.resize(r.count(6));
+	for (std::size_t i = 0; i < cp.patterns.size(); i++) {
+		cp.patterns[i].position = (vanity_position_t) r.u8();
+		cp.patterns[i].flags = r.u8();
+		cp.patterns[i].text = r.str();
+	}
+
+	cp.next_key = r.u64();
+	cp.pending.resize(r.count(16));
+	for (std::size_t i = 0; i < cp.pending.size(); i++) {
+		cp.pending[i].first = r.u64();
+		cp.pending[i].count = r.u64();
+	}
+
+	cp.keys = r.u64();
+	cp.seconds = r.u64() / 1000.0;
+
+	cp.matches.resize(r.count(EC_PRIVKEY_SIZE + EC_PUBKEY_SIZE + 12));
+	for (std::size_t i = 0; i < cp.matches.size(); i++) {
+		vanity_match_t& m = cp.matches[i];
+		r.bytes(m.key.secret.data(), m.key.secret.size());
+		r.bytes(m.key.pub.data(), m.key.pub.size());
+		m.pattern = r.u32();
+		m.index = r.u64();
+		if (m.pattern >= cp.patterns.size()) {
+			r.ok = false;
+		}
+		m.pub = wif_pub_encode(m.key.pub, cp.prefix);
+	}
+
+	return r.ok && r.p == r.end ? 0 : -1;
+}
+
+}} // namespace libeosio::internal
@@ -0,0 +1,80 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_VANITY_CHECKPOINT_H
+#define LIBEOSIO_VANITY_CHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <libeosio/vanity.hpp>
+
+namespace libeosio { namespace internal {
+
+/**
+ * Keys base + first to base + first + count - 1 of a search.
+ */
+struct vanity_range {
+	uint64_t first;
+	uint64_t count;
+};
+
+/**
+ * Saved state of a vanity search.
+ *
+ * All keys below `next_key` are done, except the ones in `pending`.
+ */
+struct vanity_checkpoint {
+	ec_privkey_t base;
+	std::string prefix;                       // Public key prefix of the codec.
+	std::vector<vanity_pattern_t> patterns;
+	uint64_t next_key;
+	std::vector<vanity_range> pending;
+	uint64_t keys;
+	double seconds;
+	std::vector<vanity_match_t> matches;
+};
+
+/**
+ * File format, all integers are little endian:
+ *
+ *   magic "EOSVANCP", u32 version,
+ *   base[32], u32 prefix length, prefix,
+ *   u32 patterns, { u8 position, u8 flags, u32 length, text } for each pattern,
+ *   u64 next_key, u32 pending, { u64 first, u64 count } for each pending range,
+ *   u64 keys, u64 milliseconds,
+ *   u32 matches, { secret[32], pub[33], u32 pattern, u64 index } for each match,
+ *   checksum[4] (sha256d of everything before it).
+ *
+ * The file is written to a temporary file that is renamed over `filename` once
+ * complete, so a crash while saving leaves the previous checkpoint intact. The
+ * file is readable by the owner only, it holds private keys.
+ *
+ * Returns 0 on success, -1 on error (or if the file is corrupt when reading).
+ */
+int vanity_checkpoint_write(const std::string& filename, const vanity_checkpoint& cp);
+int vanity_checkpoint_read(const std::string& filename, vanity_checkpoint& cp);
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_VANITY_CHECKPOINT_H */
@@ -0,0 +1,241 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <libeosio/vanity.hpp>
+#include "../base58/fixed.hpp"
+
+namespace libeosio {
+
+// Base58 digits, plus one symbol for every other character.
+#define MATCHER_SYMBOLS 64
+#define MATCHER_OTHER 58
+
+// Flag combinations, one automaton each.
+#define MATCHER_GROUPS 4
+
+// Set in a transition if patterns end in the state it leads to.
+#define MATCHER_OUTPUT 0x80000000u
+
+namespace {
+
+struct automaton {
+	// Input character to symbol, with the folding of the group applied.
+	unsigned char sym[256];
+	// Transition table. Entries are the offset (state * MATCHER_SYMBOLS) of the next
+	// state, or'ed with MATCHER_OUTPUT. The next state is `next[offset + symbol]`.
+	std::vector<uint32_t> next;
+	// Patterns that end in a state are `out[out_start[state]]` to `out[out_start[state + 1] - 1]`,
+	// in ascending order.
+	std::vector<uint32_t> out_start;
+	std::vector<uint32_t> out;
+};
+
+} // namespace
+
+struct vanity_matcher::impl {
+	std::vector<vanity_pattern_t> patterns;
+	std::vector<automaton> groups;
+};
+
+// Map `c` to the character every character it matches under `flags` is folded to.
+static char _fold(unsigned int flags, char c) {
+
+	if (flags & VANITY_LEET) {
+		static const char leet[] = "oizeasgtbg";
+		if (c >= '0' && c <= '9') {
+			c = leet[c - '0'];
+		}
+	}
+
+	// Lower case, unless only the upper case letter is base58 (L).
+	if ((flags & VANITY_IGNORE_CASE) && std::isalpha((unsigned char) c)) {
+		char lower = (char) std::tolower((unsigned char) c);
+		c = internal::base58_table[(unsigned char) lower] >= 0 ? lower : (char) std::toupper((unsigned char) c);
+	}
+
+	return c;
+}
+
+// Build the automaton for patterns `ids`, all with `flags`. Returns false if a character
+// can never match.
+static bool _build(automaton& a, unsigned int flags, const std::vector<vanity_pattern_t>& patterns,
+	const std::vector<uint32_t>& ids) {
+
+	std::vector<std::vector<uint32_t> > outputs(1);
+	std::vector<uint32_t> fail(1, 0);
+	std::deque<uint32_t> queue;
+
+	for (int c = 0; c < 256; c++) {
+		int8_t v = internal::base58_table[(unsigned char) _fold(flags, (char) c)];
+		a.sym[c] = v >= 0 ? (unsigned char) v : MATCHER_OTHER;
+	}
+
+	// Trie, 0 is the root and missing edges are 0 for now.
+	a.next.assign(MATCHER_SYMBOLS, 0);
+	for (std::size_t i = 0; i < ids.size(); i++) {
+		const std::string& text = patterns[ids[i]].text;
+		uint32_t state = 0;
+
+		for (std::size_t j = 0; j < text.size(); j++) {
+			unsigned char sym = a.sym[(unsigned char) text[j]];
+
+			if (sym == MATCHER_OTHER) {
+				return false;
+			}
+
+			if (a.next[state * MATCHER_SYMBOLS + sym] == 0) {
+				a.next[state * MATCHER_SYMBOLS + sym] = (uint32_t) outputs.size();
+				a.next.resize(a.next.size() + MATCHER_SYMBOLS, 0);
+				outputs.push_back(std::vector<uint32_t>());
+				fail.push_back(0);
+			}
+			state = a.next[state * MATCHER_SYMBOLS + sym];
+		}
+		outputs[state].push_back(ids[i]);
+	}
+
+	// Breadth first: fill in the missing edges from the failure links and merge the
+	// outputs of the failure state, turning the trie into a complete automaton.
+	for (unsigned int sym = 0; sym < MATCHER_SYMBOLS; sym++) {
+		if (a.next[sym] != 0) {
+			queue.push_back(a.next[sym]);
+		}
+	}
+
+	while (!queue.empty()) {
+		uint32_t state = queue.front();
+		queue.pop_front();
+
+		outputs[state].insert(outputs[state].end(), outputs[fail[state]].begin(), outputs[fail[state]].end());
+
+		for (unsigned int sym = 0; sym < MATCHER_SYMBOLS; sym++) {
+			uint32_t& edge = a.next[state * MATCHER_SYMBOLS + sym];
+			uint32_t to = a.next[fail[state] * MATCHER_SYMBOLS + sym];
+
+			if (edge == 0) {
+				edge = to;
+			} else {
+				fail[edge] = to;
+				queue.push_back(edge);
+			}
+		}
+	}
+
+	a.out_start.assign(1, 0);
+	a.out.clear();
+	for (std::size_t i = 0; i < outputs.size(); i++) {
+		std::sort(outputs[i].begin(), outputs[i].end());
+		a.out.insert(a.out.end(), outputs[i].begin(), outputs[i].end());
+		a.out_start.push_back((uint32_t) a.out.size());
+	}
+
+	for (std::size_t i = 0; i < a.next.size(); i++) {
+		uint32_t to = a.next[i];
+		a.next[i] = to * MATCHER_SYMBOLS | (outputs[to].empty() ? 0 : MATCHER_OUTPUT);
+	}
+
+	return true;
+}
+
+vanity_matcher::vanity_matcher() : p(new impl()) {
+}
+
+vanity_matcher::~vanity_matcher() {
+	delete p;
+}
+
+bool vanity_matcher::compile(const std::vector<vanity_pattern_t>& patterns) {
+
+	std::vector<uint32_t> ids[MATCHER_GROUPS];
+	std::size_t maxlen = base58_encoded_size(EC_PUBKEY_SIZE + CHECKSUM_SIZE);
+
+	p->patterns.clear();
+	p->groups.clear();
+
+	for (std::size_t i = 0; i < patterns.size(); i++) {
+		const std::string& text = patterns[i].text;
+
+		if (text.empty() || text.size() > maxlen) {
+			return false;
+		}
+		ids[patterns[i].flags & (MATCHER_GROUPS - 1)].push_back((uint32_t) i);
+	}
+
+	for (unsigned int flags = 0; flags < MATCHER_GROUPS; flags++) {
+		if (ids[flags].empty()) {
+			continue;
+		}
+
+		p->groups.push_back(automaton());
+		if (!_build(p->groups.back(), flags, patterns, ids[flags])) {
+			p->groups.clear();
+			return false;
+		}
+	}
+
+	p->patterns = patterns;
+	return !patterns.empty();
+}
+
+int vanity_matcher::match(const char *str, std::size_t len) const {
+
+	uint32_t state[MATCHER_GROUPS] = { 0 };
+	std::size_t n = p->groups.size();
+	uint32_t best = (uint32_t) p->patterns.size();
+
+	for (std::size_t i = 0; i < len; i++) {
+		for (std::size_t g = 0; g < n; g++) {
+			const automaton& a = p->groups[g];
+			uint32_t s = a.next[state[g] + a.sym[(unsigned char) str[i]]];
+
+			if (!(s & MATCHER_OUTPUT)) {
+				state[g] = s;
+				continue;
+			}
+
+			s &= ~MATCHER_OUTPUT;
+			state[g] = s;
+			s /= MATCHER_SYMBOLS;
+
+			// Lowest pattern that ends here and is at the right place.
+			for (uint32_t o = a.out_start[s]; o < a.out_start[s + 1] && a.out[o] < best; o++) {
+				const vanity_pattern_t& pattern = p->patterns[a.out[o]];
+
+				if ((pattern.position == VANITY_PREFIX && i + 1 != pattern.text.size())
+					|| (pattern.position == VANITY_SUFFIX && i + 1 != len)) {
+					continue;
+				}
+
+				best = a.out[o];
+				break;
+			}
+		}
+	}
+
+	return best < p->patterns.size() ? (int) best : -1;
+}
+
+} // namespace libeosio
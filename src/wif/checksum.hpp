@@ -0,0 +1,144 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef LIBEOSIO_WIF_CHECKSUM_H
+#define LIBEOSIO_WIF_CHECKSUM_H
+
+#include <cstring>
+#include <libeosio/checksum.hpp>
+#include <libeosio/ec.hpp>
+#include <libeosio/hash.hpp>
+#include "../hash/common.hpp"
+#include "../hash/transform.hpp"
+
+namespace libeosio { namespace internal {
+
+/**
+ * Checksum kernels
+ *
+ * WIF payloads have a fixed size and some of the hashed bytes are always the same
+ * (the 0x80 prefix for legacy private keys and the "K1" suffix for K1 material).
+ *
+ * So instead of going through a hash context, the padded message blocks are built
+ * once per payload size with the constant bytes, the padding and the length
+ * already in place. A call only copies the template, writes the payload into it
+ * and runs the compression function.
+ */
+
+// Padded message of `P` constant prefix bytes, `N` data bytes and `T` constant tail bytes.
+template <std::size_t P, std::size_t N, std::size_t T, bool BigEndian>
+struct padded_message {
+	static const std::size_t length = P + N + T;
+	// Where the data bytes go.
+	static const std::size_t offset = P;
+	static const std::size_t size = N;
+	static const std::size_t blocks = (length + 1 + 8 + 63) / 64;
+
+	unsigned char data[blocks * 64];
+
+	padded_message(const char* prefix, const char* tail) {
+		std::memset(data, 0, sizeof(data));
+		std::memcpy(data, prefix, P);
+		std::memcpy(data + P + N, tail, T);
+		data[length] = 0x80;
+		if (BigEndian) {
+			write_be64(data + sizeof(data) - 8, length * 8);
+		} else {
+			write_le64(data + sizeof(data) - 8, length * 8);
+		}
+	}
+};
+
+// Checksum (ripemd160) of the message `tmpl` with `data` written into it.
+template <class M>
+inline void message_checksum_ripemd160(const M& tmpl, const unsigned char *data, checksum_t crc) {
+	M msg(tmpl);
+	uint32_t s[5];
+
+	std::memcpy(msg.data + M::offset, data, M::size);
+	std::memcpy(s, ripemd160_initial_state, sizeof(s));
+	ripemd160_transform(s, msg.data, M::blocks);
+
+	write_le32(crc, s[0]);
+}
+
+/**
+ * ripemd160(data || "K1"), used for all K1 keys and signatures. The "K1" suffix
+ * is hashed but is not part of the encoded string.
+ */
+template <std::size_t N>
+inline void checksum_k1(const unsigned char *data, checksum_t crc) {
+	static const padded_message<0, N, 2, false> tmpl("", "K1");
+	message_checksum_ripemd160(tmpl, data, crc);
+}
+
+/**
+ * Second pass of sha256d, the input is always the 32 byte result of the first pass.
+ * `s` is the state after the first pass and is replaced by the final state.
+ */
+inline void sha256d_second(uint32_t *s) {
+	static const padded_message<0, 32, 0, true> tmpl("", "");
+	unsigned char block[64];
+
+	std::memcpy(block, tmpl.data, sizeof(block));
+	for (int i = 0; i < 8; i++) {
+		write_be32(block + i * 4, s[i]);
+	}
+
+	std::memcpy(s, sha256_initial_state, 8 * sizeof(uint32_t));
+	sha256_transform(s, block, 1);
+}
+
+/**
+ * ripemd160(data || tail) for `n` payloads at once, with the batch hash functions.
+ * Payload `k` starts at `buf + k * stride` with `N` data bytes followed by room for the
+ * checksum. The `T` bytes of `tail` are written to that room while hashing.
+ */
+template <std::size_t N, std::size_t T>
+inline void checksum_ripemd160_batch(unsigned char *buf, std::size_t n, std::size_t stride, const char *tail) {
+
+	const unsigned char *data[HASH_BATCH_MAX_LANES];
+	std::size_t len[HASH_BATCH_MAX_LANES];
+	ripemd160_t hash[HASH_BATCH_MAX_LANES];
+
+	for (std::size_t i = 0; i < n; i += HASH_BATCH_MAX_LANES) {
+		std::size_t m = n - i < HASH_BATCH_MAX_LANES ? n - i : HASH_BATCH_MAX_LANES;
+
+		for (std::size_t k = 0; k < m; k++) {
+			unsigned char *p = buf + (i + k) * stride;
+			std::memcpy(p + N, tail, T);
+			data[k] = p;
+			len[k] = N + T;
+		}
+
+		ripemd160_batch(data, len, m, hash);
+
+		for (std::size_t k = 0; k < m; k++) {
+			std::memcpy(buf + (i + k) * stride + N, hash[k], CHECKSUM_SIZE);
+		}
+	}
+}
+
+}} // namespace libeosio::internal
+
+#endif /* LIBEOSIO_WIF_CHECKSUM_H */
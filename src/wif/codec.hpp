@@ -25,7 +25,7 @@
 #define LIBEOSIO_CODEC_H
 
 #include <libeosio/WIF.hpp>
-#include <vector>
+#include <cstddef>
 
 namespace libeosio { namespace internal {
 
@@ -38,14 +38,28 @@ void pub_encoder_legacy(const ec_pubkey_t& key, unsigned char *buf);
 
 void pub_encoder_k1(const ec_pubkey_t& key, unsigned char *buf);
 
+/**
+ * Public-key batch encoders
+ *
+ * Same payloads as the encoders above for `n` keys at once, payload `k` is written
+ * to `buf + k * stride`. The checksums are computed several at a time.
+ */
+typedef void (*pub_batch_encoder_t)(const ec_pubkey_t* keys, std::size_t n, unsigned char *buf, std::size_t stride);
+
+void pub_batch_encoder_legacy(const ec_pubkey_t* keys, std::size_t n, unsigned char *buf, std::size_t stride);
+
+void pub_batch_encoder_k1(const ec_pubkey_t* keys, std::size_t n, unsigned char *buf, std::size_t stride);
+
 /**
  * Public-key decoders
+ *
+ * Decoders takes the base58 decoded payload (`len` bytes at `buf`)
  */
-typedef bool (*pub_decoder_t)(const std::vector<unsigned char>& buf, ec_pubkey_t& key);
+typedef bool (*pub_decoder_t)(const unsigned char *buf, std::size_t len, ec_pubkey_t& key);
 
-bool pub_decoder_legacy(const std::vector<unsigned char>& buf, ec_pubkey_t& key);
+bool pub_decoder_legacy(const unsigned char *buf, std::size_t len, ec_pubkey_t& key);
 
-bool pub_decoder_k1(const std::vector<unsigned char>& buf, ec_pubkey_t& key);
+bool pub_decoder_k1(const unsigned char *buf, std::size_t len, ec_pubkey_t& key);
 
 /**
  * Private-key encoders
@@ -59,11 +73,11 @@ size_t priv_encoder_k1(const ec_privkey_t& priv, unsigned char *buf);
 /**
  * Private-key decoders
  */
-typedef bool (*priv_decoder_t)(const std::vector<unsigned char>&, ec_privkey_t&);
+typedef bool (*priv_decoder_t)(const unsigned char *, std::size_t, ec_privkey_t&);
 
-bool priv_decoder_legacy(const std::vector<unsigned char>& buf, ec_privkey_t& priv);
+bool priv_decoder_legacy(const unsigned char *buf, std::size_t len, ec_privkey_t& priv);
 
-bool priv_decoder_k1(const std::vector<unsigned char>& buf, ec_privkey_t& priv);
+bool priv_decoder_k1(const unsigned char *buf, std::size_t len, ec_privkey_t& priv);
 
 /**
  * Signature encoders
@@ -75,9 +89,9 @@ void sig_encoder_k1(const ec_signature_t& sig, unsigned char *buf);
 /**
  * Signature decoders
  */
-typedef bool (*sig_decoder_t)(const std::vector<unsigned char>& buf, ec_signature_t& sig);
+typedef bool (*sig_decoder_t)(const unsigned char *buf, std::size_t len, ec_signature_t& sig);
 
-bool sig_decoder_k1(const std::vector<unsigned char>& buf, ec_signature_t& sig);
+bool sig_decoder_k1(const unsigned char *buf, std::size_t len, ec_signature_t& sig);
 
 }} // namespace libeosio::internal
 
@@ -23,53 +23,52 @@
  */
 
 #include <libeosio/checksum.hpp>
-#include <vector>
+#include "checksum.hpp"
 #include "codec.hpp"
 
 namespace libeosio { namespace internal {
 
-// Just to make it "harder" the calculated checksum for a signature (k1) and pub/priv keys in k1/r1 format.
-// has a suffix that is not present in the WIF encoded string.
-// So this function is a quick hack to calculate it.
-//
-// Should implement and use Init/Update/Finalize hash functions to do it inplace.
-void _checksum_suffix(const unsigned char *in, size_t size, const char *suffix, checksum_t check) {
-	std::vector<unsigned char> buf(size + 2);
-
-	memcpy(buf.data(), in, size);
-	memcpy(buf.data() + size, suffix, 2);
-
-	return checksum_ripemd160(buf.data(), buf.size(), (unsigned char*) check);
-}
-
 void pub_encoder_k1(const ec_pubkey_t& key, unsigned char *buf) {
 
 	checksum_t check;
 
-	_checksum_suffix(key.data(), EC_PUBKEY_SIZE, "K1", check);
+	checksum_k1<EC_PUBKEY_SIZE>(key.data(), check);
 
 	memcpy(buf, key.data(), EC_PUBKEY_SIZE);
 	memcpy(buf + EC_PUBKEY_SIZE, check, CHECKSUM_SIZE);
 }
 
-bool pub_decoder_k1(const std::vector<unsigned char>& buf, ec_pubkey_t& key) {
+void pub_batch_encoder_k1(const ec_pubkey_t* keys, std::size_t n, unsigned char *buf, std::size_t stride) {
+
+	for (std::size_t k = 0; k < n; k++) {
+		memcpy(buf + k * stride, keys[k].data(), EC_PUBKEY_SIZE);
+	}
+
+	checksum_ripemd160_batch<EC_PUBKEY_SIZE, 2>(buf, n, stride, "K1");
+}
+
+bool pub_decoder_k1(const unsigned char *buf, std::size_t len, ec_pubkey_t& key) {
 
 	checksum_t check;
 
-	_checksum_suffix(buf.data(), EC_PUBKEY_SIZE, "K1", check);
+	if (len != EC_PUBKEY_SIZE + CHECKSUM_SIZE) {
+		return false;
+	}
+
+	checksum_k1<EC_PUBKEY_SIZE>(buf, check);
 
-	if (memcmp(buf.data() + EC_PUBKEY_SIZE, check, CHECKSUM_SIZE)) {
+	if (memcmp(buf + EC_PUBKEY_SIZE, check, CHECKSUM_SIZE)) {
 		return false;
 	}
 
-	memcpy(key.data(), buf.data(), EC_PUBKEY_SIZE);
+	memcpy(key.data(), buf, EC_PUBKEY_SIZE);
 	return true;
 }
 
 size_t priv_encoder_k1(const ec_privkey_t& priv, unsigned char *buf) {
 	checksum_t check;
 
-	_checksum_suffix(priv.data(), EC_PRIVKEY_SIZE, "K1", check);
+	checksum_k1<EC_PRIVKEY_SIZE>(priv.data(), check);
 
 	memcpy(buf, priv.data(), priv.size());
 	memcpy(buf + EC_PRIVKEY_SIZE, check, CHECKSUM_SIZE);
@@ -77,19 +76,19 @@ size_t priv_encoder_k1(const ec_privkey_t& priv, unsigned char *buf) {
 	return EC_PRIVKEY_SIZE + CHECKSUM_SIZE;
 }
 
-bool priv_decoder_k1(const std::vector<unsigned char>& buf, ec_privkey_t& priv) {
+bool priv_decoder_k1(const unsigned char *buf, std::size_t len, ec_privkey_t& priv) {
 
-	if (buf.size() != EC_PRIVKEY_SIZE + CHECKSUM_SIZE) {
+	if (len != EC_PRIVKEY_SIZE + CHECKSUM_SIZE) {
 		return false;
 	}
 
 	checksum_t check;
-	_checksum_suffix(buf.data(), EC_PRIVKEY_SIZE, "K1", check);
-	if (memcmp(buf.data() + EC_PRIVKEY_SIZE, check, CHECKSUM_SIZE)) {
+	checksum_k1<EC_PRIVKEY_SIZE>(buf, check);
+	if (memcmp(buf + EC_PRIVKEY_SIZE, check, CHECKSUM_SIZE)) {
 		return false;
 	}
 
-	memcpy(priv.data(), buf.data(), priv.size());
+	memcpy(priv.data(), buf, priv.size());
 	return true;
 }
 
@@ -97,30 +96,30 @@ void sig_encoder_k1(const ec_signature_t& sig, unsigned char *buf) {
 
 	checksum_t check;
 
-	_checksum_suffix(sig.data(), EC_SIGNATURE_SIZE, "K1", check);
+	checksum_k1<EC_SIGNATURE_SIZE>(sig.data(), check);
 
 	memcpy(buf, sig.data(), sig.size());
 	memcpy(buf + EC_SIGNATURE_SIZE, check, CHECKSUM_SIZE);
 }
 
-bool sig_decoder_k1(const std::vector<unsigned char>& buf, ec_signature_t& sig) {
+bool sig_decoder_k1(const unsigned char *buf, std::size_t len, ec_signature_t& sig) {
 
 	checksum_t check;
 
-	if (buf.size() != EC_SIGNATURE_SIZE + CHECKSUM_SIZE) {
+	if (len != EC_SIGNATURE_SIZE + CHECKSUM_SIZE) {
 		return false;
 	}
 
 	// Calculate checksum
-	_checksum_suffix(buf.data(), EC_SIGNATURE_SIZE, "K1", check);
+	checksum_k1<EC_SIGNATURE_SIZE>(buf, check);
 
 	// And validate
-	if (memcmp(buf.data() + EC_SIGNATURE_SIZE, check, CHECKSUM_SIZE)) {
+	if (memcmp(buf + EC_SIGNATURE_SIZE, check, CHECKSUM_SIZE)) {
 		return false;
 	}
 
 	// Copy data to output
-	memcpy(sig.data(), buf.data(), sig.size());
+	memcpy(sig.data(), buf, sig.size());
 	return true;
 }
 
@@ -23,29 +23,66 @@
  */
 
 #include <libeosio/checksum.hpp>
+#include "checksum.hpp"
 #include "codec.hpp"
 
 namespace libeosio { namespace internal {
 
 #define PRIV_KEY_PREFIX 0x80 /* 0x80 for "Bitcoin mainnet". Always used by EOS. */
 
+static void _checksum_pub(const unsigned char *key, checksum_t check) {
+	static const padded_message<0, EC_PUBKEY_SIZE, 0, false> tmpl("", "");
+	message_checksum_ripemd160(tmpl, key, check);
+}
+
+// sha256d(PRIV_KEY_PREFIX || key)
+static void _checksum_priv(const unsigned char *key, checksum_t check) {
+	static const char prefix[1] = { (char) PRIV_KEY_PREFIX };
+	static const padded_message<1, EC_PRIVKEY_SIZE, 0, true> tmpl(prefix, "");
+	padded_message<1, EC_PRIVKEY_SIZE, 0, true> msg(tmpl);
+	uint32_t s[8];
+
+	memcpy(msg.data + msg.offset, key, msg.size);
+	memcpy(s, sha256_initial_state, sizeof(s));
+	sha256_transform(s, msg.data, msg.blocks);
+	sha256d_second(s);
+
+	write_be32(check, s[0]);
+}
+
 void pub_encoder_legacy(const ec_pubkey_t& key, unsigned char *buf) {
 
 	checksum_t check;
 
-	checksum_ripemd160(key.data(), EC_PUBKEY_SIZE, check);
+	_checksum_pub(key.data(), check);
 
 	memcpy(buf, key.data(), EC_PUBKEY_SIZE);
 	memcpy(buf + EC_PUBKEY_SIZE, check, CHECKSUM_SIZE);
 }
 
-bool pub_decoder_legacy(const std::vector<unsigned char>& buf, ec_pubkey_t& key) {
+void pub_batch_encoder_legacy(const ec_pubkey_t* keys, std::size_t n, unsigned char *buf, std::size_t stride) {
+
+	for (std::size_t k = 0; k < n; k++) {
+		memcpy(buf + k * stride, keys[k].data(), EC_PUBKEY_SIZE);
+	}
+
+	checksum_ripemd160_batch<EC_PUBKEY_SIZE, 0>(buf, n, stride, "");
+}
 
-	if (!checksum_validate<checksum_ripemd160>(buf.data(), buf.size())) {
+bool pub_decoder_legacy(const unsigned char *buf, std::size_t len, ec_pubkey_t& key) {
+
+	checksum_t check;
+
+	if (len != EC_PUBKEY_SIZE + CHECKSUM_SIZE) {
 		return false;
 	}
 
-	memcpy(key.data(), buf.data(), EC_PUBKEY_SIZE);
+	_checksum_pub(buf, check);
+	if (memcmp(buf + EC_PUBKEY_SIZE, check, CHECKSUM_SIZE)) {
+		return false;
+	}
+
+	memcpy(key.data(), buf, EC_PUBKEY_SIZE);
 	return true;
 }
 
@@ -54,26 +91,28 @@ size_t priv_encoder_legacy(const ec_privkey_t& priv, unsigned char *buf) {
 
 	buf[0] = PRIV_KEY_PREFIX;
 	memcpy(buf + 1, priv.data(), EC_PRIVKEY_SIZE);
-	checksum_sha256d(buf, 1 + EC_PRIVKEY_SIZE, check);
+	_checksum_priv(priv.data(), check);
 	memcpy(buf + 1 + EC_PRIVKEY_SIZE, check, CHECKSUM_SIZE);
 
 	return 1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE;
 }
 
-bool priv_decoder_legacy(const std::vector<unsigned char>& buf, ec_privkey_t& priv) {
-	if (buf[0] != PRIV_KEY_PREFIX) {
+bool priv_decoder_legacy(const unsigned char *buf, std::size_t len, ec_privkey_t& priv) {
+	if (len != 1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE) {
 		return false;
 	}
 
-	if (buf.size() != 1 + EC_PRIVKEY_SIZE + CHECKSUM_SIZE) {
+	if (buf[0] != PRIV_KEY_PREFIX) {
 		return false;
 	}
 
-	if (!checksum_validate<checksum_sha256d>(buf.data(), buf.size())) {
+	checksum_t check;
+	_checksum_priv(buf + 1, check);
+	if (memcmp(buf + 1 + EC_PRIVKEY_SIZE, check, CHECKSUM_SIZE)) {
 		return false;
 	}
 
-	memcpy(priv.data(), buf.data() + 1, priv.size());
+	memcpy(priv.data(), buf + 1, priv.size());
 	return true;
 }
 
@@ -68,4 +68,34 @@ TEST_CASE("WIF::wif_pub_encode [k1]") {
 			CHECK( libeosio::wif_pub_encode(it->key, it->prefix) == it->expected );
 		}
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("WIF::wif_pub_encode_batch") {
+
+	std::vector<libeosio::ec_pubkey_t> keys(40);
+
+	// Distinct keys, more than one batch worth.
+	for (size_t k = 0; k < keys.size(); k++) {
+		keys[k][0] = 0x02 + (k & 1);
+		for (size_t i = 1; i < keys[k].size(); i++) {
+			keys[k][i] = (unsigned char) (k * 31 + i * 7);
+		}
+	}
+
+	const std::string prefixes[] = { libeosio::WIF_PUB_K1, libeosio::WIF_PUB_LEG, "ZYX" };
+
+	for (size_t p = 0; p < 3; p++) {
+
+		SUBCASE(prefixes[p].c_str()) {
+			const size_t stride = libeosio::wif_pub_encoded_size(prefixes[p]);
+			std::vector<char> out(stride * keys.size());
+
+			REQUIRE( libeosio::wif_pub_encode_batch(keys.data(), keys.size(), out.data(), stride, prefixes[p]) );
+
+			for (size_t k = 0; k < keys.size(); k++) {
+				CHECK( std::string(&out[k * stride]) == libeosio::wif_pub_encode(keys[k], prefixes[p]) );
+			}
+
+			CHECK_FALSE( libeosio::wif_pub_encode_batch(keys.data(), keys.size(), out.data(), stride - 1, prefixes[p]) );
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#include <libeosio/WIF.hpp>
+#include <string>
+#include <vector>
+#include <doctest.h>
+
+static libeosio::ec_pubkey_t _add(libeosio::ec_pubkey_t key, int n) {
+	for (int k = 0; k < (n < 0 ? -n : n); k++) {
+		for (size_t i = key.size(); i-- > 0; ) {
+			if (n > 0 ? key[i]++ != 0xff : key[i]-- != 0x00) {
+				break;
+			}
+		}
+	}
+	return key;
+}
+
+static bool _matches(const libeosio::ec_pubkey_t& key, const std::string& prefix) {
+	return libeosio::wif_pub_encode(key, libeosio::WIF_PUB_LEG).compare(3, prefix.size(), prefix) == 0
+		&& libeosio::wif_pub_encode(key, libeosio::WIF_PUB_K1).compare(7, prefix.size(), prefix) == 0;
+}
+
+TEST_CASE("WIF::wif_pub_prefix_ranges") {
+
+	const char* prefixes[] = { "5", "6Ab", "7kzJ5", "8SwZ" };
+	const libeosio::ec_pubkey_t min = { 0x02 };
+	const libeosio::ec_pubkey_t max = _add({ 0x04 }, -1);
+
+	for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); i++) {
+
+		SUBCASE(prefixes[i]) {
+			const std::string prefix = prefixes[i];
+			std::vector<libeosio::wif_pub_range_t> ranges;
+
+			REQUIRE( libeosio::wif_pub_prefix_ranges(prefix, ranges) );
+			REQUIRE( ranges.size() == 1 );
+
+			const libeosio::wif_pub_range_t& r = ranges[0];
+
+			// Inside
+			CHECK( _matches(_add(r.first, 1), prefix) );
+			CHECK( _matches(_add(r.last, -1), prefix) );
+
+			// Outside (unless clamped to the compressed key range)
+			if (r.first != min) {
+				CHECK_FALSE( _matches(_add(r.first, -1), prefix) );
+			}
+			if (r.last != max) {
+				CHECK_FALSE( _matches(_add(r.last, 1), prefix) );
+			}
+		}
+	}
+}
+
+TEST_CASE("WIF::wif_pub_prefix_ranges [known keys]") {
+
+	const libeosio::ec_pubkey_t key = { 0x03, 0x7a, 0x0e, 0x6b, 0xfd, 0xe4, 0xf1, 0xad, 0x36, 0x3f, 0x3a, 0xf9, 0xe0, 0x93, 0x63, 0x5a, 0xa9, 0x99, 0x21, 0x15, 0xbc, 0x23, 0x35, 0x75, 0x13, 0x69, 0x55, 0xee, 0x3f, 0xf8, 0xfd, 0x97, 0xec };
+	std::vector<libeosio::wif_pub_range_t> ranges;
+
+	// EOS7kzJ5iFBmQWWT1LiWgAiocESD7TTNuuPCdYREUQysruq8VeFKy
+	REQUIRE( libeosio::wif_pub_prefix_ranges("7kzJ5iFBmQ", ranges) );
+	REQUIRE( ranges.size() == 1 );
+	CHECK( ranges[0].first < key );
+	CHECK( key < ranges[0].last );
+
+	REQUIRE( libeosio::wif_pub_prefix_ranges("7kzJ5iFBmR", ranges) );
+	REQUIRE( ranges.size() == 1 );
+	CHECK( key < ranges[0].first );
+}
+
+TEST_CASE("WIF::wif_pub_prefix_ranges [no match]") {
+
+	std::vector<libeosio::wif_pub_range_t> ranges;
+
+	// Compressed keys always encode to 50 characters starting with 5-8
+	CHECK( libeosio::wif_pub_prefix_ranges("Hi", ranges) );
+	CHECK( ranges.empty() );
+	CHECK( libeosio::wif_pub_prefix_ranges("2", ranges) );
+	CHECK( ranges.empty() );
+
+	CHECK_FALSE( libeosio::wif_pub_prefix_ranges("1", ranges) );
+	CHECK_FALSE( libeosio::wif_pub_prefix_ranges("0x", ranges) );
+}
@@ -78,7 +78,13 @@ TEST_CASE("WIF::wif_sig_decode") {
 			false,
 		},
 		{
-			"invalid #5 - non-base58",
+			"invalid #5 - huge",
+			"SIG_K1_" + std::string(1024 * 1024, 'z'),
+			{},
+			false,
+		},
+		{
+			"invalid #6 - non-base58",
 			"SIG_K1_6sCX2LiY2EpKdJtK7DJMGUETSNdDBNP3MjoZlF1i2V6RFhjoqd1jZbIAobdeARzQxpqHBvJpOWhKxBdA28CsVYJQe0VdcL",
 			{},
 			false,
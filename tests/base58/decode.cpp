@@ -45,4 +45,142 @@ TEST_CASE("base58_decode") {
 			CHECK( result == expectedOut );
 		}
 	}
-}
\ No newline at end of file
+}
+TEST_CASE("base58_decode [buffer]") {
+
+	const std::string in = " 5yAgp6rBagDHQZ3GacZSeaEPF2jfuwVHM21aNfXETJgn3EkArxc5UWSq1RM\n";
+	const std::string expected = "Cras fringilla, eros et imperdiet tincidunt";
+	unsigned char out[128];
+
+	SUBCASE("large buffer") {
+		size_t len = sizeof(out);
+		CHECK( libeosio::base58_decode(in.data(), in.size(), out, len) );
+		CHECK( std::string((char*) out, len) == expected );
+	}
+
+	SUBCASE("exact buffer") {
+		size_t len = expected.size();
+		CHECK( libeosio::base58_decode(in.data(), in.size(), out, len) );
+		CHECK( std::string((char*) out, len) == expected );
+	}
+
+	SUBCASE("too small") {
+		size_t len = expected.size() - 1;
+		CHECK_FALSE( libeosio::base58_decode(in.data(), in.size(), out, len) );
+		CHECK( len == libeosio::base58_decoded_size(in.size() - 2) );
+
+		// The reported size is large enough.
+		CHECK( libeosio::base58_decode(in.data(), in.size(), out, len) );
+		CHECK( std::string((char*) out, len) == expected );
+	}
+
+	SUBCASE("too small (leading ones)") {
+		const std::string ones = "111111111111111111111111111111111111112";
+		size_t len = 4;
+		CHECK_FALSE( libeosio::base58_decode(ones.data(), ones.size(), out, len) );
+		CHECK( len == 38 + libeosio::base58_decoded_size(1) );
+
+		CHECK( libeosio::base58_decode(ones.data(), ones.size(), out, len) );
+		CHECK( len == 39 );
+	}
+
+	SUBCASE("too small (fixed width)") {
+		const std::string ones(60, '1');
+		size_t len = 37;
+		CHECK_FALSE( libeosio::base58_decode(ones.data(), ones.size(), out, len) );
+		CHECK( len == 60 + libeosio::base58_decoded_size(0) );
+	}
+
+	SUBCASE("not nul terminated") {
+		const char str[] = { '1', '1', '2', 'x' };
+		size_t len = sizeof(out);
+		CHECK( libeosio::base58_decode(str, 3, out, len) );
+		CHECK( len == 3 );
+		CHECK( out[0] == 0 );
+		CHECK( out[1] == 0 );
+		CHECK( out[2] == 1 );
+	}
+
+	SUBCASE("invalid") {
+		size_t len = sizeof(out);
+		CHECK_FALSE( libeosio::base58_decode("5yAgp6rBag0HQZ3", 15, out, len) );
+		CHECK( len == sizeof(out) );
+
+		// Too long as well, still not a size to retry with.
+		len = 4;
+		CHECK_FALSE( libeosio::base58_decode("5yAgp6rBag0HQZ3", 15, out, len) );
+		CHECK( len == 4 );
+
+		len = 37;
+		CHECK_FALSE( libeosio::base58_decode(std::string(60, '0').data(), 60, out, len) );
+		CHECK( len == 37 );
+	}
+}
+
+TEST_CASE("base58_decode [leading ones]") {
+
+	// Every leading zero byte is a '1' of its own, the size bound must count them.
+	const size_t zeroes[] = { 1, 3, 10, 36, 37, 50 };
+
+	for (size_t z : zeroes) {
+		for (size_t tail = 0; tail <= 2; tail++) {
+			std::vector<unsigned char> data(z, 0), result;
+			for (size_t i = 0; i < tail; i++) {
+				data.push_back((unsigned char) (0x80 + i));
+			}
+
+			const std::string str = libeosio::base58_encode(data);
+			REQUIRE( str.compare(0, z, std::string(z, '1')) == 0 );
+
+			CHECK( libeosio::base58_decode(str, result) );
+			CHECK( result == data );
+
+			result.clear();
+			CHECK( libeosio::base58_decode(str.c_str(), result) );
+			CHECK( result == data );
+		}
+	}
+
+	std::vector<unsigned char> result;
+	const std::vector<unsigned char> expected = { 0, 0, 0, 1 };
+	CHECK( libeosio::base58_decode("1112", result) );
+	CHECK( result == expected );
+	CHECK( libeosio::base58_decode(std::string("  1112  "), result) );
+	CHECK( result == expected );
+}
+
+TEST_CASE("base58_decode [bounded]") {
+
+	// Would take minutes to decode if the length was not checked up front.
+	const std::string huge(1024 * 1024, 'z');
+	unsigned char out[69];
+
+	SUBCASE("buffer") {
+		size_t len = sizeof(out);
+		CHECK_FALSE( libeosio::base58_decode(huge.data(), huge.size(), out, len) );
+	}
+
+	SUBCASE("buffer (generic size)") {
+		size_t len = sizeof(out) - 1;
+		CHECK_FALSE( libeosio::base58_decode(huge.data(), huge.size(), out, len) );
+	}
+
+	SUBCASE("leading ones") {
+		const std::string ones(1024 * 1024, '1');
+		size_t len = sizeof(out) - 1;
+		CHECK_FALSE( libeosio::base58_decode(ones.data(), ones.size(), out, len) );
+	}
+
+	SUBCASE("vector") {
+		std::vector<unsigned char> result;
+		CHECK_FALSE( libeosio::base58_decode(huge, result, 69) );
+		CHECK( result.empty() );
+	}
+
+	SUBCASE("vector (fits)") {
+		std::vector<unsigned char> result;
+		std::vector<unsigned char> expected = { 'C', 'r', 'a', 's' };
+		CHECK( libeosio::base58_decode("2izbCN", result, 4) );
+		CHECK( result == expected );
+	}
+}
@@ -31,4 +31,69 @@ TEST_CASE("base58::base58_encode") {
 			CHECK( libeosio::base58_encode(it->in) == it->expected );
 		}
 	}
-}
\ No newline at end of file
+}
+static std::vector<unsigned char> _from_hex(const std::string& hex) {
+	std::vector<unsigned char> out;
+	for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+		out.push_back(std::stoi(hex.substr(i, 2), nullptr, 16));
+	}
+	return out;
+}
+
+TEST_CASE("base58::base58_encode [fixed]") {
+
+	struct testcase {
+		const char* name;
+		std::string in;
+		std::string expected;
+	};
+
+	// Key and signature sized payloads (36, 37 and 69 bytes)
+	std::vector<struct testcase> tests = {
+		{ "zeroes_36", "000000000000000000000000000000000000000000000000000000000000000000000000", "111111111111111111111111111111111111" },
+		{ "leading_zero_37", "0000ca978112ca1bbdcafac231b39a23dc4da786eff8147c4e72b9807785afee48bb010203", "11MDStnfHHoaxMiLZY6wfCA4qochwNgxJQtBS6X8gU2VVdhjjQ" },
+		{ "max_37", "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", "9adaAMuB9v8yX1mZ5PtoB6VFSCeqRGjASd8ZTM6VUkiHLCYAQ8v" },
+		{ "sig_69", "a4abd4448c49562d828115d13a1fccea927f52b4d5459297f8b43e42da89238bc13626e43dcb38ddb082488927ec904fb42057443983e88585179d50551afe620001020304", "2e6Bbcdx6LqbcMkLiWm5a4LR6JBQptczHgjDD1Jd11N3ghGE2h6Zgi1pawM3Wt6fMDkhaSpCEM4pzEW6BHGJZFc9Gw7EY4K" },
+		{ "one_69", "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001", "111111111111111111111111111111111111111111111111111111111111111111112" },
+	};
+
+	for(auto it = tests.begin(); it != tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			CHECK( libeosio::base58_encode(_from_hex(it->in)) == it->expected );
+		}
+	}
+}
+
+TEST_CASE("base58::base58_encode [buffer]") {
+
+	const std::string in = "Cras fringilla, eros et imperdiet tincidunt";
+	const std::string expected = "5yAgp6rBagDHQZ3GacZSeaEPF2jfuwVHM21aNfXETJgn3EkArxc5UWSq1RM";
+	const unsigned char *data = (const unsigned char *) in.data();
+	char out[128];
+
+	SUBCASE("large buffer") {
+		size_t len = sizeof(out);
+		CHECK( libeosio::base58_encode(data, in.size(), out, len) );
+		CHECK( std::string(out, len) == expected );
+	}
+
+	SUBCASE("exact buffer") {
+		size_t len = expected.size();
+		CHECK( libeosio::base58_encode(data, in.size(), out, len) );
+		CHECK( std::string(out, len) == expected );
+	}
+
+	SUBCASE("too small") {
+		size_t len = expected.size() - 1;
+		CHECK_FALSE( libeosio::base58_encode(data, in.size(), out, len) );
+		CHECK( len == libeosio::base58_encoded_size(in.size()) );
+	}
+
+	SUBCASE("leading zeroes") {
+		const unsigned char zeroes[] = { 0, 0, 0, 1 };
+		size_t len = sizeof(out);
+		CHECK( libeosio::base58_encode(zeroes, sizeof(zeroes), out, len) );
+		CHECK( std::string(out, len) == "1112" );
+	}
+}
@@ -0,0 +1,111 @@
+#include <libeosio/base58.hpp>
+#include <vector>
+#include "base58/batch.hpp"
+#include "cpu.hpp"
+#include <doctest.h>
+
+// Deterministic payloads, some with leading zero bytes.
+static std::vector<unsigned char> _payloads(size_t len, size_t count) {
+	std::vector<unsigned char> data(len * count);
+	uint32_t x = 0x12345678;
+
+	for (size_t i = 0; i < data.size(); i++) {
+		x = x * 1103515245 + 12345;
+		data[i] = x >> 24;
+	}
+
+	for (size_t k = 0; k < count; k += 3) {
+		for (size_t i = 0; i < len && i < k % 7; i++) {
+			data[k * len + i] = 0;
+		}
+	}
+
+	// All zero and all ones.
+	if (count > 1) {
+		std::fill(data.begin(), data.begin() + len, 0x00);
+		std::fill(data.begin() + len, data.begin() + 2 * len, 0xff);
+	}
+
+	return data;
+}
+
+TEST_CASE("base58::base58_encode_batch") {
+
+	const size_t sizes[] = { 0, 1, 2, 3, 20, 32, 33, 36, 37, 64, 65, 69, 100, 128, 129, 200 };
+	const size_t count = 37;
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+
+		const size_t len = sizes[s];
+		const size_t stride = libeosio::base58_encoded_size(len) + 1;
+		std::vector<unsigned char> data = _payloads(len, count);
+		std::vector<char> out(stride * count);
+		std::vector<size_t> lengths(count);
+
+		SUBCASE(std::to_string(len).c_str()) {
+			REQUIRE( libeosio::base58_encode_batch(data.data(), len, count, out.data(), stride, lengths.data()) );
+
+			for (size_t k = 0; k < count; k++) {
+				std::vector<unsigned char> in(data.begin() + k * len, data.begin() + (k + 1) * len);
+				std::string expected = libeosio::base58_encode(in);
+
+				CHECK( std::string(&out[k * stride]) == expected );
+				CHECK( lengths[k] == expected.size() );
+			}
+		}
+	}
+}
+
+TEST_CASE("base58::base58_encode_batch [stride]") {
+
+	const unsigned char data[37] = { 0 };
+	char out[128];
+
+	CHECK_FALSE( libeosio::base58_encode_batch(data, sizeof(data), 1, out, libeosio::base58_encoded_size(sizeof(data))) );
+	CHECK( libeosio::base58_encode_batch(data, sizeof(data), 1, out, libeosio::base58_encoded_size(sizeof(data)) + 1) );
+	CHECK( std::string(out) == std::string(37, '1') );
+}
+
+static void _check_kernel(libeosio::internal::base58_batch_kernel_t kernel) {
+
+	const size_t sizes[] = { 0, 1, 2, 3, 20, 32, 33, 37, 65, 100, 128 };
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+
+		const size_t len = sizes[s];
+		const size_t stride = libeosio::base58_encoded_size(len) + 1;
+		std::vector<unsigned char> data = _payloads(len, BASE58_BATCH_LANES);
+		libeosio::internal::base58_batch_plan plan;
+
+		libeosio::internal::base58_batch_prepare(plan, len);
+
+		for (size_t n = 1; n <= BASE58_BATCH_LANES; n += 5) {
+			std::vector<char> out(stride * n), expected(stride * n);
+			std::vector<size_t> lengths(n), expected_lengths(n);
+
+			libeosio::internal::base58_encode_lanes_generic(plan, data.data(), n, expected.data(), stride, expected_lengths.data());
+			kernel(plan, data.data(), n, out.data(), stride, lengths.data());
+
+			for (size_t k = 0; k < n; k++) {
+				CHECK( std::string(&out[k * stride]) == std::string(&expected[k * stride]) );
+				CHECK( lengths[k] == expected_lengths[k] );
+			}
+		}
+	}
+}
+
+#if defined(LIBEOSIO_SIMD_X86)
+TEST_CASE("base58::base58_encode_batch [avx2]") {
+	if (!libeosio::internal::cpu_get_features().avx2) {
+		return;
+	}
+	_check_kernel(libeosio::internal::base58_encode_lanes_avx2);
+}
+
+TEST_CASE("base58::base58_encode_batch [avx512]") {
+	if (!libeosio::internal::cpu_get_features().avx512bw) {
+		return;
+	}
+	_check_kernel(libeosio::internal::base58_encode_lanes_avx512);
+}
+#endif
@@ -2,6 +2,9 @@
 #include <iostream>
 #include <vector>
 #include <doctest.h>
+#include "base58/classify.hpp"
+#include "cpu.hpp"
+#include "test_helpers.hpp"
 
 TEST_CASE("base58::is_base58 [string]") {
 
@@ -18,6 +21,9 @@ TEST_CASE("base58::is_base58 [string]") {
 		{"I", "5hWrCBA55zLmKpIhZd3RS1DHsJ7SnZpnyBfmibqGpDCJ7QCJGkogvhqPvGuwMgwNHzuZFyR", 14},
 		{"l", "lHxVA2fQKawLAK9MCJSr2xaWyDpoquQxVP6MMchdhzY49TjTfti8LDR6YL", 0},
 		{"all_valid", "2BCoJ2BqNWorSoQcSWCQNanB8teoKFaqjojWGEXPBCPPdoGyVN8dgmKRdw", std::string::npos},
+		{"long_all_valid", "9P7SxYWTWMq5hHkri53b1CGvWKRXxq3uXWPs5RiVtYagFrsnTXDxvKnk1twkPmV7BuxcRhBHWSwFLXpXbmdfHwZrnDaTB3wrBhsjm2Dd7F95ixh5vQLxajmT8hd22yUbvXuAZci8vTgFWMUyQi5YzWwntQiK5KFDkx3oA7kxvdU5t1yJZur84a9aKTCihEWtvCJ6LoBCpxvyB16YaCKeBQWLbUqoaXvFoDM78BpKD8biYyWQhnzHonjdwAS4KNXs5ByBdBvvPK1Q2Knr8zuFZxKHEFmgZGFTt8SMSsTDjkanUjojbfpJt5gcrHh6UFrt45n7kT9sj9Xsf1UyXZG3E2H85jXSbVnKowz2VPq1TkLLUKG8CSfdH3fVRp2E3yL5cpbbFWngbMzsbBZDgr4kPPcazebvSZ8qm8taBcBmt1ry25ey9TfFbMzP4FR1q9yjvkqGusMtrrBFm8YEeRmoMugMQoXvUgpExh29j", std::string::npos},
+		{"long_space", "9P7SxYWTWMq5hHkri53b1CGvWKRXxq3uXWPs5RiVtYagFrsnTXDxvKnk1twkPmV7BuxcRhBHWSwFLXpXbmdfHwZrnDaTB3wrBhsjm2 d7F95ixh5vQLxajmT8hd22yUbvXuAZci8vTgFWMUyQi5YzW", 102},
+		{"long_high_bit", "9P7SxYWTWMq5hHkri53b1CGvWKRXxq3uXWPs5RiVtYagFrsnTXDxvKnk1twkPmV7BuxcRhBHWSwFLXpXbmdfHwZrnDaTB3wr\xc3\xa5", 96},
 	};
 
 	for(auto it = tests.begin(); it != tests.end(); it++) {
@@ -49,4 +55,33 @@ TEST_CASE("base58::is_base58 [char]") {
 			CHECK_FALSE(libeosio::is_base58(ch));
 		}
 	}
-}
\ No newline at end of file
+}
+
+static void _check_find_invalid(std::size_t (*kernel)(const char *, std::size_t)) {
+	std::vector<std::string> inputs = base58_kernel_inputs();
+
+	for (size_t i = 0; i < inputs.size(); i++) {
+		const std::string& str = inputs[i];
+		CHECK( kernel(str.data(), str.size()) == libeosio::internal::base58_find_invalid_scalar(str.data(), str.size()) );
+	}
+}
+
+#if defined(LIBEOSIO_SIMD_X86)
+TEST_CASE("base58::is_base58 [sse41]") {
+	if (libeosio::internal::cpu_get_features().sse41) {
+		_check_find_invalid(libeosio::internal::base58_find_invalid_sse41);
+	}
+}
+
+TEST_CASE("base58::is_base58 [avx2]") {
+	if (libeosio::internal::cpu_get_features().avx2) {
+		_check_find_invalid(libeosio::internal::base58_find_invalid_avx2);
+	}
+}
+
+TEST_CASE("base58::is_base58 [avx512]") {
+	if (libeosio::internal::cpu_get_features().avx512bw) {
+		_check_find_invalid(libeosio::internal::base58_find_invalid_avx512);
+	}
+}
+#endif
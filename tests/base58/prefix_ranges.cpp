@@ -0,0 +1,62 @@
+#include <libeosio/base58.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+
+static bool _in_ranges(const std::vector<libeosio::base58_range_t>& ranges, const unsigned char* p, size_t len) {
+	for (size_t i = 0; i < ranges.size(); i++) {
+		if (std::memcmp(p, ranges[i].first.data(), len) >= 0 && std::memcmp(p, ranges[i].last.data(), len) <= 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_CASE("base58::base58_prefix_ranges") {
+
+	// Compare against every 2 byte payload.
+	const char* prefixes[] = { "2", "z", "5Q", "Ab", "LUv", "LUw", "zzz", "21", "9" };
+
+	for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); i++) {
+
+		SUBCASE(prefixes[i]) {
+			const std::string prefix = prefixes[i];
+			std::vector<libeosio::base58_range_t> ranges;
+
+			REQUIRE( libeosio::base58_prefix_ranges(prefix, 2, ranges) );
+
+			for (size_t j = 1; j < ranges.size(); j++) {
+				CHECK( ranges[j - 1].last < ranges[j].first );
+			}
+
+			for (unsigned int v = 0; v < 0x10000; v++) {
+				const unsigned char p[2] = { (unsigned char) (v >> 8), (unsigned char) v };
+				std::string enc = libeosio::base58_encode(p, p + 2);
+
+				CHECK( _in_ranges(ranges, p, 2) == (enc.compare(0, prefix.size(), prefix) == 0) );
+			}
+		}
+	}
+}
+
+TEST_CASE("base58::base58_prefix_ranges [no match]") {
+
+	std::vector<libeosio::base58_range_t> ranges;
+
+	// 2 bytes encode to atmost 3 characters (max is "LUv")
+	CHECK( libeosio::base58_prefix_ranges("2222", 2, ranges) );
+	CHECK( ranges.empty() );
+	CHECK( libeosio::base58_prefix_ranges("LUw", 2, ranges) );
+	CHECK( ranges.empty() );
+}
+
+TEST_CASE("base58::base58_prefix_ranges [invalid]") {
+
+	std::vector<libeosio::base58_range_t> ranges;
+
+	CHECK_FALSE( libeosio::base58_prefix_ranges("", 37, ranges) );
+	CHECK_FALSE( libeosio::base58_prefix_ranges("1abc", 37, ranges) );
+	CHECK_FALSE( libeosio::base58_prefix_ranges("abc0", 37, ranges) );
+	CHECK_FALSE( libeosio::base58_prefix_ranges("aIc", 37, ranges) );
+}
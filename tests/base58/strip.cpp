@@ -0,0 +1,70 @@
+#include <libeosio/base58.hpp>
+#include <iostream>
+#include <vector>
+#include <doctest.h>
+#include "base58/classify.hpp"
+#include "cpu.hpp"
+#include "test_helpers.hpp"
+
+TEST_CASE("base58::base58_strip") {
+
+	struct testcase{
+		const char *name;
+		std::string input;
+		std::string expected;
+	};
+
+	std::vector<struct testcase> tests = {
+		{"empty", "", ""},
+		{"all_valid", "2BCoJ2BqNWorSoQcSWCQNanB8teoKFaqjojWGEXPBCPPdoGyVN8dgmKRdw", "2BCoJ2BqNWorSoQcSWCQNanB8teoKFaqjojWGEXPBCPPdoGyVN8dgmKRdw"},
+		{"all_invalid", "0OIl 0OIl\t\n0OIl", ""},
+		{"short", "a0b", "ab"},
+		{"spaces", " 5hWrCBA55zLmKpIh Zd3RS1DHsJ7SnZpnyBfmibqGpDCJ7QCJGkogvhqPvGuwMgwNHzuZFyR ", "5hWrCBA55zLmKphZd3RS1DHsJ7SnZpnyBfmibqGpDCJ7QCJGkogvhqPvGuwMgwNHzuZFyR"},
+		{
+			"long",
+			"EOS-7kzJ5iFBmQWWT1LiWgAiocESD7TTNuuPCdYREUQysruq8VeFKy, EOS-5c9HkNCJLDebe2Wvapp8bpB38Pf1QWNpkrsFy3mshg7DZfPNeA, EOS-8SwZMY8DChbbmRKS3wdHCAbv1VWgTRmQEDSaLyJk8pG4wm8BJF",
+			"ES7kzJ5iFBmQWWT1LiWgAiocESD7TTNuuPCdYREUQysruq8VeFKyES5c9HkNCJLDebe2Wvapp8bpB38Pf1QWNpkrsFy3mshg7DZfPNeAES8SwZMY8DChbbmRKS3wdHCAbv1VWgTRmQEDSaLyJk8pG4wm8BJF"
+		},
+	};
+
+	for(auto it = tests.begin(); it != tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			std::string str = it->input;
+			CHECK(libeosio::base58_strip(str) == it->expected);
+			CHECK(str == it->expected);
+		}
+	}
+}
+
+static void _check_compact(std::size_t (*kernel)(char *, std::size_t)) {
+	std::vector<std::string> inputs = base58_kernel_inputs();
+
+	for (size_t i = 0; i < inputs.size(); i++) {
+		std::string str = inputs[i], expected = inputs[i];
+
+		str.resize(kernel(&str[0], str.size()));
+		expected.resize(libeosio::internal::base58_compact_scalar(&expected[0], expected.size()));
+		CHECK( str == expected );
+	}
+}
+
+#if defined(LIBEOSIO_SIMD_X86)
+TEST_CASE("base58::base58_strip [sse41]") {
+	if (libeosio::internal::cpu_get_features().sse41) {
+		_check_compact(libeosio::internal::base58_compact_sse41);
+	}
+}
+
+TEST_CASE("base58::base58_strip [avx2]") {
+	if (libeosio::internal::cpu_get_features().avx2) {
+		_check_compact(libeosio::internal::base58_compact_avx2);
+	}
+}
+
+TEST_CASE("base58::base58_strip [avx512]") {
+	if (libeosio::internal::cpu_get_features().avx512bw) {
+		_check_compact(libeosio::internal::base58_compact_avx512);
+	}
+}
+#endif
@@ -22,8 +22,12 @@
  * SOFTWARE.
  */
 #include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
 #include <libeosio/ec.hpp>
 #include <libeosio/WIF.hpp>
+#include <libeosio/hash.hpp>
 
 
 std::chrono::duration<float> _run(size_t num_keys) {
@@ -47,14 +51,226 @@ void test(size_t num_keys) {
 		<< "KPS: " << kps << std::endl;
 }
 
-int main() {
-	libeosio::ec_init();
+// Sequential keys, generated `batch` at a time.
+void test_sequential(size_t num_keys, size_t batch) {
+	float t, kps;
+	std::vector<libeosio::ec_keypair> pairs(batch);
+
+	std::cout << "Running sequential benchmark for " << num_keys << " keys (batch " << batch << ")" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_keys; i += batch) {
+		libeosio::ec_generate_keys_sequential(pairs.data(), batch);
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	kps = static_cast<float>(num_keys) / t;
+
+	std::cout << "Time: " << t << std::endl
+		<< "KPS: " << kps << std::endl;
+}
+
+// Every thread generates `num_keys` keys with its own default context.
+void test_threads(size_t num_keys, unsigned threads) {
+	float t, kps;
+	std::vector<std::thread> pool;
+
+	std::cout << "Running benchmark for " << num_keys << " keys on " << threads << " threads" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned i = 0; i < threads; i++) {
+		pool.push_back(std::thread([num_keys]() { _run(num_keys); }));
+	}
+	for (unsigned i = 0; i < threads; i++) {
+		pool[i].join();
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	kps = static_cast<float>(num_keys * threads) / t;
+
+	std::cout << "Time: " << t << std::endl
+		<< "KPS: " << kps << std::endl;
+}
+
+// Signs `num_sigs` digests with ecdsa_sign(), then with an ec_signer.
+void test_sign(size_t num_sigs) {
+	float t;
+	std::vector<libeosio::sha256_t> digests(num_sigs);
+	std::vector<libeosio::ec_signature_t> sigs(num_sigs);
+	struct libeosio::ec_keypair k;
+	libeosio::ec_signer signer;
+
+	libeosio::ec_generate_key(&k);
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+	}
+
+	std::cout << "Running sign benchmark for " << num_sigs << " signatures" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::ecdsa_sign(k.secret, &digests[i], sigs[i]);
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+
+	std::cout << "Running signer benchmark for " << num_sigs << " signatures" << std::endl;
+	start = std::chrono::steady_clock::now();
+	signer.set_key(k.secret);
+	signer.sign_many(digests.data(), num_sigs, sigs.data());
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+}
+
+// Verifies `num_sigs` signatures one by one, then with ecdsa_verify_batch().
+void test_verify(size_t num_sigs) {
+	float t;
+	std::vector<libeosio::sha256_t> digests(num_sigs);
+	std::vector<libeosio::ec_signature_t> sigs(num_sigs);
+	std::vector<libeosio::ec_pubkey_t> keys(num_sigs);
+	struct libeosio::ec_keypair k;
+
+	for (size_t i = 0; i < num_sigs; i++) {
+		if (i % 16 == 0) {
+			libeosio::ec_generate_key(&k);
+		}
+		libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+		libeosio::ecdsa_sign(k.secret, &digests[i], sigs[i]);
+		keys[i] = k.pub;
+	}
+
+	std::cout << "Running verify benchmark for " << num_sigs << " signatures" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::ecdsa_verify(&digests[i], sigs[i], keys[i]);
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+
+	std::cout << "Running batch verify benchmark for " << num_sigs << " signatures" << std::endl;
+	start = std::chrono::steady_clock::now();
+	libeosio::ecdsa_verify_batch(digests.data(), sigs.data(), keys.data(), num_sigs);
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+}
+
+// Verifies `num_sigs` signatures by the same key, with and without preparing it.
+void test_verify_prepared(size_t num_sigs) {
+	float t;
+	std::vector<libeosio::sha256_t> digests(num_sigs);
+	std::vector<libeosio::ec_signature_t> sigs(num_sigs);
+	struct libeosio::ec_keypair k;
+
+	libeosio::ec_generate_key(&k);
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+		libeosio::ecdsa_sign(k.secret, &digests[i], sigs[i]);
+	}
+
+	std::cout << "Running verify benchmark for " << num_sigs << " signatures by one key" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::ecdsa_verify(&digests[i], sigs[i], k.pub);
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+
+	for (int precompute = 0; precompute < 2; precompute++) {
+		libeosio::ec_pubkey_prepared key;
+
+		std::cout << "Running prepared verify benchmark for " << num_sigs << " signatures by one key"
+			<< (precompute ? " (precomputed)" : "") << std::endl;
+		start = std::chrono::steady_clock::now();
+		key.set(k.pub, precompute);
+		for (size_t i = 0; i < num_sigs; i++) {
+			libeosio::ecdsa_verify_prepared(&digests[i], sigs[i], key);
+		}
+		t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << "Time: " << t << std::endl
+			<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+	}
+}
+
+// Recovers `num_sigs` keys one by one, then with ecdsa_recover_batch() on one thread per cpu.
+void test_recover(size_t num_sigs) {
+	float t;
+	std::vector<libeosio::sha256_t> digests(num_sigs);
+	std::vector<libeosio::ec_signature_t> sigs(num_sigs);
+	std::vector<libeosio::ec_pubkey_t> keys(num_sigs);
+	std::vector<int> status(num_sigs);
+	struct libeosio::ec_keypair k;
+
+	libeosio::ec_generate_key(&k);
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+		libeosio::ecdsa_sign(k.secret, &digests[i], sigs[i]);
+	}
+
+	std::cout << "Running recover benchmark for " << num_sigs << " signatures" << std::endl;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_sigs; i++) {
+		libeosio::ecdsa_recover(&digests[i], sigs[i], keys[i]);
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+
+	std::cout << "Running batch recover benchmark for " << num_sigs << " signatures on "
+		<< std::thread::hardware_concurrency() << " threads" << std::endl;
+	start = std::chrono::steady_clock::now();
+	libeosio::ecdsa_recover_batch(digests.data(), sigs.data(), num_sigs, keys.data(), status.data());
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Time: " << t << std::endl
+		<< "SPS: " << static_cast<float>(num_sigs) / t << std::endl;
+}
+
+// Runs every benchmark with `backend`.
+void run_backend(libeosio::ec_backend_t backend) {
+	libeosio::ec_init(backend);
+	std::cout << "Backend: " << libeosio::ec_backend_name(libeosio::ec_get_backend()) << std::endl;
 
 	test(1000);
 	test(10000);
 	test(100000);
 
+	test_sequential(100000, 256);
+	test_sequential(1000000, 4096);
+
+	test_sign(10000);
+	test_verify(10000);
+	test_verify_prepared(10000);
+	test_recover(10000);
+
 	libeosio::ec_shutdown();
 
+	unsigned threads = std::thread::hardware_concurrency();
+	if (threads > 1) {
+		test_threads(10000, threads);
+	}
+}
+
+int main() {
+
+	// Only the backend named by LIBEOSIO_EC_BACKEND if set, otherwise all of them.
+	if (std::getenv("LIBEOSIO_EC_BACKEND")) {
+		run_backend(libeosio::EC_BACKEND_DEFAULT);
+		return 0;
+	}
+
+	if (libeosio::ec_backend_available(libeosio::EC_BACKEND_LIBSECP256K1)) {
+		run_backend(libeosio::EC_BACKEND_LIBSECP256K1);
+	}
+	if (libeosio::ec_backend_available(libeosio::EC_BACKEND_OPENSSL)) {
+		run_backend(libeosio::EC_BACKEND_OPENSSL);
+	}
+
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,90 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <libeosio/hash.hpp>
+
+template <typename F>
+void test(const char *name, size_t num, F fn) {
+	float t, ops;
+
+	auto start = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < num; i++) {
+		fn();
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	ops = static_cast<float>(num) / t;
+
+	std::cout << name << ": " << num << " calls" << std::endl
+		<< "Time: " << t << std::endl
+		<< "OPS: " << ops << std::endl;
+}
+
+int main() {
+	// 1024 messages of the sizes hashed by the WIF codecs (33 - 69 bytes).
+	const size_t count = 1024;
+	std::vector<unsigned char> msg(count * 69, 0x5a);
+	std::vector<const unsigned char*> data(count);
+	std::vector<size_t> len(count);
+	std::vector<libeosio::sha256_t> sha(count);
+	std::vector<libeosio::ripemd160_t> rmd(count);
+
+	for (size_t i = 0; i < count; i++) {
+		data[i] = msg.data() + i * 69;
+		len[i] = 33 + i % 37;
+	}
+
+	// Per call overhead, 37 bytes is a public key with its checksum.
+	test("sha256 (37 bytes)", 1000000, [&]() { libeosio::sha256(msg.data(), 37, &sha[0]); });
+	test("sha256d (37 bytes)", 1000000, [&]() { libeosio::sha256d(msg.data(), 37, &sha[0]); });
+	test("ripemd160 (37 bytes)", 1000000, [&]() { libeosio::ripemd160(msg.data(), 37, &rmd[0]); });
+
+	test("sha256 (1024 messages)", 1000, [&]() {
+		for (size_t i = 0; i < count; i++) {
+			libeosio::sha256(data[i], len[i], &sha[i]);
+		}
+	});
+	test("sha256_batch (1024 messages)", 1000, [&]() {
+		libeosio::sha256_batch(data.data(), len.data(), count, sha.data());
+	});
+	test("sha256d (1024 messages)", 1000, [&]() {
+		for (size_t i = 0; i < count; i++) {
+			libeosio::sha256d(data[i], len[i], &sha[i]);
+		}
+	});
+	test("sha256d_batch (1024 messages)", 1000, [&]() {
+		libeosio::sha256d_batch(data.data(), len.data(), count, sha.data());
+	});
+	test("ripemd160 (1024 messages)", 1000, [&]() {
+		for (size_t i = 0; i < count; i++) {
+			libeosio::ripemd160(data[i], len[i], &rmd[i]);
+		}
+	});
+	test("ripemd160_batch (1024 messages)", 1000, [&]() {
+		libeosio::ripemd160_batch(data.data(), len.data(), count, rmd.data());
+	});
+
+	return 0;
+}
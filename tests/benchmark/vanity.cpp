@@ -0,0 +1,131 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <libeosio/ec.hpp>
+#include <libeosio/WIF.hpp>
+#include <libeosio/vanity.hpp>
+
+using namespace libeosio;
+
+// What callers did before the search engine: one key at a time on one thread.
+void test_loop(size_t num_keys, const std::string& pattern) {
+	float t;
+	size_t found = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < num_keys; i++) {
+		struct ec_keypair k;
+		ec_generate_key(&k);
+		if (wif_pub_encode(k.pub).find(pattern) != std::string::npos) {
+			found++;
+		}
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "loop (anywhere " << pattern << "): " << num_keys << " keys, "
+		<< found << " found, " << num_keys / t << " KPS" << std::endl;
+}
+
+// Scan `n` keys for `count` words, with the matcher and with one find() per word.
+void test_matcher(size_t n, size_t count) {
+
+	const char* words[] = { "eos", "abc", "xyz", "moon", "pump", "doge", "cat", "dog", "sun", "sky" };
+	std::vector<vanity_pattern_t> patterns;
+	std::vector<std::string> keys;
+	vanity_matcher m;
+	size_t found = 0;
+	float t;
+
+	for (size_t i = 0; i < count; i++) {
+		std::string w = words[i % 10];
+		if (i >= 10) {
+			w += "123456789"[(i / 10 - 1) % 9];
+		}
+		patterns.push_back({ w, VANITY_ANYWHERE, 0 });
+	}
+	m.compile(patterns);
+
+	for (size_t i = 0; i < 4096; i++) {
+		struct ec_keypair k;
+		ec_generate_key(&k);
+		keys.push_back(wif_pub_encode(k.pub).substr(WIF_PUB_K1.size()));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < n; i++) {
+		found += m.match(keys[i % keys.size()]) >= 0;
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "matcher (" << count << " patterns): " << n / t << " keys/s, " << found << " found" << std::endl;
+
+	found = 0;
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < patterns.size(); j++) {
+			if (keys[i % keys.size()].find(patterns[j].text) != std::string::npos) {
+				found++;
+				break;
+			}
+		}
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "find (" << count << " patterns): " << n / t << " keys/s, " << found << " found" << std::endl;
+}
+
+void test_search(uint64_t num_keys, const vanity_pattern_t& pattern, unsigned int threads, const char* name) {
+
+	vanity_search search({ pattern });
+
+	search.set_threads(threads);
+	search.set_max_keys(num_keys);
+	search.run();
+
+	vanity_stats_t st = search.stats();
+	std::cout << "search (" << name << " " << pattern.text << ", " << threads << " threads): "
+		<< st.keys << " keys, " << st.matches << " found, " << st.kps << " KPS" << std::endl;
+}
+
+int main() {
+
+	unsigned int threads = std::thread::hardware_concurrency();
+
+	test_matcher(1000000, 1);
+	test_matcher(1000000, 10);
+	test_matcher(1000000, 50);
+
+	test_loop(50000, "abc");
+
+	test_search(2000000, { "abc", VANITY_ANYWHERE, 0 }, 1, "anywhere");
+	test_search(10000000, { "7abc", VANITY_PREFIX, 0 }, 1, "prefix");
+
+	if (threads > 1) {
+		test_search(2000000 * threads, { "abc", VANITY_ANYWHERE, 0 }, threads, "anywhere");
+		test_search(10000000 * threads, { "7abc", VANITY_PREFIX, 0 }, threads, "prefix");
+	}
+
+	return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2019-2023 EOS Sw/eden
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <string>
+#include <vector>
+#include <libeosio/ec.hpp>
+#include <libeosio/WIF.hpp>
+
+template <typename F>
+void test(const char *name, size_t num, F fn) {
+	float t, ops;
+
+	auto start = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < num; i++) {
+		fn();
+	}
+	t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+	ops = static_cast<float>(num) / t;
+
+	std::cout << name << ": " << num << " calls" << std::endl
+		<< "Time: " << t << std::endl
+		<< "OPS: " << ops << std::endl;
+}
+
+int main() {
+	struct libeosio::ec_keypair k;
+	libeosio::ec_signature_t sig;
+	libeosio::sha256_t digest = { 0 };
+	std::string pub, priv, wif_sig;
+	std::vector<libeosio::ec_pubkey_t> keys(1024);
+	std::vector<char> out;
+
+	libeosio::ec_init();
+	libeosio::ec_generate_key(&k);
+	libeosio::ecdsa_sign(k.secret, &digest, sig);
+	libeosio::ec_shutdown();
+
+	pub = libeosio::wif_pub_encode(k.pub);
+	priv = libeosio::wif_priv_encode(k.secret);
+	wif_sig = libeosio::wif_sig_encode(sig);
+
+	test("wif_pub_encode", 100000, [&]() { libeosio::wif_pub_encode(k.pub); });
+
+	keys.assign(keys.size(), k.pub);
+	out.resize(keys.size() * libeosio::wif_pub_encoded_size());
+	test("wif_pub_encode_batch (1024 keys)", 100, [&]() {
+		libeosio::wif_pub_encode_batch(keys.data(), keys.size(), out.data(), libeosio::wif_pub_encoded_size());
+	});
+	test("wif_pub_decode", 100000, [&]() { libeosio::wif_pub_decode(k.pub, pub); });
+	test("wif_priv_encode", 100000, [&]() { libeosio::wif_priv_encode(k.secret); });
+	test("wif_priv_decode", 100000, [&]() { libeosio::wif_priv_decode(k.secret, priv); });
+	test("wif_sig_encode", 100000, [&]() { libeosio::wif_sig_encode(sig); });
+	test("wif_sig_decode", 100000, [&]() { libeosio::wif_sig_decode(sig, wif_sig); });
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+#include <libeosio/ec.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <doctest.h>
+#include "ec_backend.hpp"
+
+static std::vector<libeosio::ec_backend_t> available_backends() {
+	std::vector<libeosio::ec_backend_t> list;
+
+	if (libeosio::ec_backend_available(libeosio::EC_BACKEND_LIBSECP256K1)) {
+		list.push_back(libeosio::EC_BACKEND_LIBSECP256K1);
+	}
+	if (libeosio::ec_backend_available(libeosio::EC_BACKEND_OPENSSL)) {
+		list.push_back(libeosio::EC_BACKEND_OPENSSL);
+	}
+	return list;
+}
+
+TEST_CASE("ec::backend") {
+
+	libeosio::ec_backend_t selected = libeosio::ec_get_backend();
+	std::vector<libeosio::ec_backend_t> backends = available_backends();
+
+	REQUIRE( selected != libeosio::EC_BACKEND_DEFAULT );
+
+	// ctest runs the suite once per backend, a backend that silently fell back to
+	// another one would otherwise pass while testing the wrong implementation.
+	const char *env = std::getenv("LIBEOSIO_EC_BACKEND");
+	if (env) {
+		REQUIRE( libeosio::ec_init() == 0 );
+		CHECK( std::strcmp(libeosio::ec_backend_name(libeosio::ec_get_backend()), env) == 0 );
+	}
+
+	REQUIRE( backends.size() > 0 );
+	CHECK( libeosio::ec_backend_available(selected) );
+	CHECK( std::strcmp(libeosio::ec_backend_name(libeosio::EC_BACKEND_LIBSECP256K1), "libsecp256k1") == 0 );
+	CHECK( std::strcmp(libeosio::ec_backend_name(libeosio::EC_BACKEND_OPENSSL), "openssl") == 0 );
+	CHECK( std::strcmp(libeosio::ec_backend_name(libeosio::EC_BACKEND_DEFAULT), libeosio::ec_backend_name(selected)) == 0 );
+
+	SUBCASE("select") {
+		for (auto b : backends) {
+			REQUIRE( libeosio::ec_init(b) == 0 );
+			CHECK( libeosio::ec_get_backend() == b );
+			CHECK( libeosio::ec_default_context().backend() == b );
+
+			libeosio::ec_context ctx;
+			CHECK( ctx.backend() == b );
+		}
+
+		// A backend that is not compiled in falls back to one that is.
+		if (backends.size() == 1) {
+			libeosio::ec_backend_t other = backends[0] == libeosio::EC_BACKEND_OPENSSL ?
+				libeosio::EC_BACKEND_LIBSECP256K1 : libeosio::EC_BACKEND_OPENSSL;
+			libeosio::ec_context ctx(other);
+			libeosio::ec_keypair pair;
+
+			CHECK( !ctx.valid() );
+			CHECK( ctx.generate_key(&pair) == -1 );
+			CHECK( libeosio::ec_init(other) == 0 );
+			CHECK( libeosio::ec_get_backend() == backends[0] );
+		}
+	}
+
+	SUBCASE("interoperability") {
+		libeosio::sha256_t digest = { 0x0a, 0x0b, 0x0c };
+
+		for (auto a : backends) {
+			for (auto b : backends) {
+				libeosio::ec_context ca(a), cb(b);
+				libeosio::ec_keypair pair;
+				libeosio::ec_pubkey_t pub;
+				libeosio::ec_signature_t sig;
+				libeosio::ec_pubkey_prepared prepared(a);
+				libeosio::ec_signer signer(b);
+
+				REQUIRE( ca.generate_key(&pair) == 0 );
+				CHECK( cb.get_publickey(&pair.secret, &pub) == 0 );
+				CHECK( pub == pair.pub );
+
+				// Signed by one backend, verified and recovered by the other.
+				REQUIRE( ca.sign(pair.secret, &digest, sig) == 0 );
+				CHECK( cb.verify(&digest, sig, pair.pub) == 0 );
+				CHECK( cb.recover(&digest, sig, pub) == 0 );
+				CHECK( pub == pair.pub );
+
+				// A key prepared by another backend is verified like an unprepared one.
+				REQUIRE( prepared.set(pair.pub, true) == 0 );
+				CHECK( cb.verify_prepared(&digest, sig, prepared) == 0 );
+
+				REQUIRE( signer.set_key(pair.secret) == 0 );
+				CHECK( signer.pubkey() == pair.pub );
+				REQUIRE( signer.sign(&digest, sig) == 0 );
+				CHECK( ca.verify(&digest, sig, pair.pub) == 0 );
+			}
+		}
+	}
+
+	libeosio::ec_init(selected);
+	libeosio::ec_shutdown();
+}
+
+// Derives the wrong public key, so the self-test fails.
+static int _broken_get_publickey(void *ctx, const libeosio::ec_privkey_t *priv, libeosio::ec_pubkey_t* pub) {
+	(void) ctx;
+	(void) priv;
+	pub->fill(0x02);
+	return 0;
+}
+
+static bool _self_test(const libeosio::internal::ec_backend *b) {
+	return libeosio::internal::ec_backend_self_test(b);
+}
+
+static bool _never(const libeosio::internal::ec_backend *b) {
+	(void) b;
+	return false;
+}
+
+TEST_CASE("ec::backend [fallback]") {
+
+	const libeosio::internal::ec_backend *good = libeosio::internal::ec_backend_get(libeosio::EC_BACKEND_DEFAULT);
+	REQUIRE( good != NULL );
+
+	// A copy of a working backend that fails its self-test, under the id of another one.
+	libeosio::internal::ec_backend broken = *good;
+	broken.id = good->id == libeosio::EC_BACKEND_OPENSSL ?
+		libeosio::EC_BACKEND_LIBSECP256K1 : libeosio::EC_BACKEND_OPENSSL;
+	broken.get_publickey = _broken_get_publickey;
+
+	const libeosio::internal::ec_backend* list[] = { &broken, good };
+
+	CHECK( libeosio::internal::ec_backend_self_test(good) );
+	CHECK_FALSE( libeosio::internal::ec_backend_self_test(&broken) );
+
+	// Asked for the broken one, or preferring it, selects the working one.
+	CHECK( libeosio::internal::ec_backend_pick(list, 2, broken.id, _self_test) == good );
+	CHECK( libeosio::internal::ec_backend_pick(list, 2, libeosio::EC_BACKEND_DEFAULT, _self_test) == good );
+	CHECK( libeosio::internal::ec_backend_pick(list, 2, good->id, _self_test) == good );
+
+	// Nothing to fall back to.
+	CHECK( libeosio::internal::ec_backend_pick(list, 1, broken.id, _self_test) == NULL );
+	CHECK( libeosio::internal::ec_backend_pick(list, 2, good->id, _never) == NULL );
+}
@@ -0,0 +1,65 @@
+#include <libeosio/ec.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+
+TEST_CASE("ec::ec_context") {
+
+	libeosio::ec_context ctx;
+	libeosio::ec_keypair pair;
+	libeosio::ec_pubkey_t pub;
+	libeosio::ec_signature_t sig;
+	libeosio::sha256_t digest = { 0x01, 0x02, 0x03 };
+
+	REQUIRE( ctx.valid() );
+	REQUIRE( ctx.generate_key(&pair) == 0 );
+
+	CHECK( ctx.get_publickey(&pair.secret, &pub) == 0 );
+	CHECK( pub == pair.pub );
+
+	REQUIRE( ctx.sign(pair.secret, &digest, sig) == 0 );
+	CHECK( ctx.verify(&digest, sig, pair.pub) == 0 );
+	CHECK( ctx.recover(&digest, sig, pub) == 0 );
+	CHECK( pub == pair.pub );
+
+	// Works together with the default context.
+	libeosio::ec_signature_t sig2;
+	CHECK( libeosio::ecdsa_sign(pair.secret, &digest, sig2) == 0 );
+	CHECK( ctx.verify(&digest, sig2, pair.pub) == 0 );
+	CHECK( libeosio::ecdsa_verify(&digest, sig, pair.pub) == 0 );
+}
+
+TEST_CASE("ec::ec_default_context [threads]") {
+
+	const int threads = 4, rounds = 50;
+	std::atomic<int> failed(0);
+	std::vector<std::thread> pool;
+
+	// No ec_init(), every thread gets its own default context on first use.
+	for (int t = 0; t < threads; t++) {
+		pool.push_back(std::thread([&failed, t]() {
+			for (int i = 0; i < rounds; i++) {
+				libeosio::ec_keypair pair;
+				libeosio::ec_pubkey_t pub;
+				libeosio::ec_signature_t sig;
+				libeosio::sha256_t digest = { (unsigned char) t, (unsigned char) i };
+
+				if (libeosio::ec_generate_key(&pair) != 0
+					|| libeosio::ecdsa_sign(pair.secret, &digest, sig) != 0
+					|| libeosio::ecdsa_verify(&digest, sig, pair.pub) != 0
+					|| libeosio::ecdsa_recover(&digest, sig, pub) != 0
+					|| pub != pair.pub) {
+					failed++;
+				}
+			}
+		}));
+	}
+
+	for (size_t t = 0; t < pool.size(); t++) {
+		pool[t].join();
+	}
+
+	CHECK( failed == 0 );
+	CHECK( &libeosio::ec_default_context() == &libeosio::ec_default_context() );
+}
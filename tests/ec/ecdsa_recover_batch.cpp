@@ -0,0 +1,82 @@
+#include <libeosio/ec.hpp>
+#include <libeosio/hash.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <doctest.h>
+
+TEST_CASE("ec::ecdsa_recover_batch") {
+
+	const std::size_t count = 300;
+	std::vector<libeosio::sha256_t> digests(count);
+	std::vector<libeosio::ec_signature_t> sigs(count);
+	std::vector<libeosio::ec_pubkey_t> expected(count);
+
+	libeosio::ec_init();
+
+	for (std::size_t i = 0; i < count; i++) {
+		libeosio::ec_keypair pair;
+		REQUIRE( libeosio::ec_generate_key(&pair) == 0 );
+		libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+		REQUIRE( libeosio::ecdsa_sign(pair.secret, &digests[i], sigs[i]) == 0 );
+		expected[i] = pair.pub;
+	}
+
+	SUBCASE("valid") {
+		for (unsigned int threads : { 1, 3, 0 }) {
+			std::vector<libeosio::ec_pubkey_t> keys(count);
+			std::vector<int> status(count, -1);
+
+			CHECK( libeosio::ecdsa_recover_batch(digests.data(), sigs.data(), count, keys.data(), status.data(), threads) == 0 );
+			for (std::size_t i = 0; i < count; i++) {
+				CHECK( status[i] == 0 );
+				CHECK( keys[i] == expected[i] );
+			}
+		}
+	}
+
+	SUBCASE("not valid") {
+		std::vector<libeosio::ec_pubkey_t> keys(count);
+		std::vector<int> status(count, 0);
+
+		// r = 0 and no recovery id.
+		std::fill(sigs[7].begin() + 1, sigs[7].begin() + 33, 0);
+		sigs[250][0] = 27 + 4 + 7;
+
+		CHECK( libeosio::ecdsa_recover_batch(digests.data(), sigs.data(), count, keys.data(), status.data(), 3) == -1 );
+		for (std::size_t i = 0; i < count; i++) {
+			if (i == 7 || i == 250) {
+				CHECK( status[i] == -1 );
+				CHECK( keys[i] == libeosio::ec_pubkey_t() );
+			} else {
+				CHECK( status[i] == 0 );
+				CHECK( keys[i] == expected[i] );
+			}
+		}
+	}
+
+	SUBCASE("concurrent callers") {
+		std::vector<libeosio::ec_pubkey_t> keys[2] = { std::vector<libeosio::ec_pubkey_t>(count), std::vector<libeosio::ec_pubkey_t>(count) };
+		std::vector<int> status[2] = { std::vector<int>(count, -1), std::vector<int>(count, -1) };
+		int ret[2] = { -1, -1 };
+
+		// Both calls share the worker pool.
+		std::thread other([&]() {
+			ret[1] = libeosio::ecdsa_recover_batch(digests.data(), sigs.data(), count, keys[1].data(), status[1].data(), 3);
+		});
+		ret[0] = libeosio::ecdsa_recover_batch(digests.data(), sigs.data(), count, keys[0].data(), status[0].data(), 4);
+		other.join();
+
+		for (int c = 0; c < 2; c++) {
+			CHECK( ret[c] == 0 );
+			CHECK( keys[c] == expected );
+			CHECK( std::count(status[c].begin(), status[c].end(), 0) == (long) count );
+		}
+	}
+
+	SUBCASE("empty") {
+		CHECK( libeosio::ecdsa_recover_batch(nullptr, nullptr, 0, nullptr, nullptr) == 0 );
+	}
+
+	libeosio::ec_shutdown();
+}
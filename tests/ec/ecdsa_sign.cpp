@@ -108,6 +108,11 @@ TEST_CASE("ec::ecdsa_sign") {
 			// well, in escdsa_verify.cpp there are tests that checks hardcoded signatures generated by different implementations and should be fine.
 
 			CHECK( libeosio::ecdsa_verify(&it->dgst, result, it->pub) == 0);
+
+			// The recovery id must point back to the signing key.
+			libeosio::ec_pubkey_t recovered;
+			CHECK( libeosio::ecdsa_recover(&it->dgst, result, recovered) == 0);
+			CHECK( recovered == it->pub );
 		}
 	}
 	libeosio::ec_shutdown();
@@ -0,0 +1,79 @@
+#include <libeosio/ec.hpp>
+#include <libeosio/hash.hpp>
+#include <algorithm>
+#include <vector>
+#include <doctest.h>
+
+struct _batch {
+	std::vector<libeosio::sha256_t> digests;
+	std::vector<libeosio::ec_signature_t> sigs;
+	std::vector<libeosio::ec_pubkey_t> keys;
+
+	// Signs `count` different digests with a handful of keys.
+	explicit _batch(std::size_t count) : digests(count), sigs(count), keys(count) {
+
+		libeosio::ec_keypair pairs[8];
+
+		for (std::size_t i = 0; i < 8; i++) {
+			REQUIRE( libeosio::ec_generate_key(&pairs[i]) == 0 );
+		}
+
+		for (std::size_t i = 0; i < count; i++) {
+			libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+			REQUIRE( libeosio::ecdsa_sign(pairs[i % 8].secret, &digests[i], sigs[i]) == 0 );
+			keys[i] = pairs[i % 8].pub;
+		}
+	}
+
+	int verify(bool *valid = nullptr) {
+		return libeosio::ecdsa_verify_batch(digests.data(), sigs.data(), keys.data(), digests.size(), valid);
+	}
+};
+
+TEST_CASE("ec::ecdsa_verify_batch") {
+
+	libeosio::ec_init();
+
+	// Spans more than one batch.
+	_batch b(600);
+	bool valid[600];
+
+	SUBCASE("valid") {
+		std::fill(valid, valid + 600, false);
+
+		CHECK( b.verify() == 0 );
+		CHECK( b.verify(valid) == 0 );
+		CHECK( std::all_of(valid, valid + 600, [](bool v) { return v; }) );
+	}
+
+	SUBCASE("empty") {
+		CHECK( libeosio::ecdsa_verify_batch(nullptr, nullptr, nullptr, 0) == 0 );
+	}
+
+	SUBCASE("not valid") {
+		b.digests[3][0] ^= 1;        // other message
+		b.sigs[300][40] ^= 1;        // other s
+		b.keys[599] = b.keys[598];   // other signer
+		b.keys[450][0] = 0x05;       // not a public key
+
+		CHECK( b.verify() == -1 );
+		CHECK( b.verify(valid) == -1 );
+
+		for (std::size_t i = 0; i < 600; i++) {
+			bool bad = i == 3 || i == 300 || i == 599 || i == 450;
+			CHECK( valid[i] == !bad );
+		}
+	}
+
+	SUBCASE("wrong recovery id") {
+		// Fails the batch equation but ecdsa_verify() does not check it.
+		b.sigs[10][0] = 27 + 4 + ((b.sigs[10][0] - 27 - 4) ^ 1);
+		REQUIRE( libeosio::ecdsa_verify(&b.digests[10], b.sigs[10], b.keys[10]) == 0 );
+
+		CHECK( b.verify() == 0 );
+		CHECK( b.verify(valid) == 0 );
+		CHECK( std::all_of(valid, valid + 600, [](bool v) { return v; }) );
+	}
+
+	libeosio::ec_shutdown();
+}
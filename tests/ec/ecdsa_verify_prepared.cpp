@@ -0,0 +1,72 @@
+#include <libeosio/ec.hpp>
+#include <libeosio/hash.hpp>
+#include <doctest.h>
+
+TEST_CASE("ec::ecdsa_verify_prepared") {
+
+	libeosio::ec_init();
+
+	SUBCASE("same result as ecdsa_verify") {
+		for (int precompute = 0; precompute < 2; precompute++) {
+			for (std::size_t i = 0; i < 20; i++) {
+				libeosio::ec_keypair pair, other;
+				libeosio::ec_pubkey_prepared key;
+				libeosio::sha256_t digest;
+				libeosio::ec_signature_t sig, bad;
+
+				REQUIRE( libeosio::ec_generate_key(&pair) == 0 );
+				REQUIRE( libeosio::ec_generate_key(&other) == 0 );
+				REQUIRE( key.set(pair.pub, precompute) == 0 );
+				CHECK( key.valid() );
+				CHECK( key.key() == pair.pub );
+
+				libeosio::sha256((const unsigned char*) &i, sizeof(i), &digest);
+				REQUIRE( libeosio::ecdsa_sign(pair.secret, &digest, sig) == 0 );
+				CHECK( libeosio::ecdsa_verify_prepared(&digest, sig, key) == 0 );
+
+				// Signed by another key.
+				REQUIRE( libeosio::ecdsa_sign(other.secret, &digest, bad) == 0 );
+				CHECK( libeosio::ecdsa_verify_prepared(&digest, bad, key) == -1 );
+
+				// Other message.
+				digest[i] ^= 1;
+				CHECK( libeosio::ecdsa_verify_prepared(&digest, sig, key) == -1 );
+				digest[i] ^= 1;
+
+				// Changed r and s.
+				for (std::size_t j : { 5, 40 }) {
+					bad = sig;
+					bad[j] ^= 0x10;
+					CHECK( libeosio::ecdsa_verify_prepared(&digest, bad, key)
+						== libeosio::ecdsa_verify(&digest, bad, pair.pub) );
+				}
+			}
+		}
+	}
+
+	SUBCASE("invalid key") {
+		libeosio::ec_keypair pair;
+		libeosio::ec_pubkey_prepared key;
+		libeosio::ec_pubkey_t pub;
+		libeosio::sha256_t digest = { 0 };
+		libeosio::ec_signature_t sig;
+
+		REQUIRE( libeosio::ec_generate_key(&pair) == 0 );
+		REQUIRE( libeosio::ecdsa_sign(pair.secret, &digest, sig) == 0 );
+
+		CHECK( !key.valid() );
+		CHECK( libeosio::ecdsa_verify_prepared(&digest, sig, key) == -1 );
+
+		pub = pair.pub;
+		pub[0] = 0x05;
+		CHECK( key.set(pub, true) == -1 );
+		CHECK( !key.valid() );
+		CHECK( libeosio::ecdsa_verify_prepared(&digest, sig, key) == -1 );
+
+		// Usable again after a failed set().
+		CHECK( key.set(pair.pub, true) == 0 );
+		CHECK( libeosio::ecdsa_verify_prepared(&digest, sig, key) == 0 );
+	}
+
+	libeosio::ec_shutdown();
+}
@@ -1,5 +1,16 @@
 #include <libeosio/ec.hpp>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 #include <doctest.h>
+#if defined(LIBEOSIO_EC_LIBSECP256K1)
+#include "libsecp256k1/drbg.hpp"
+#endif
 
 TEST_CASE("ec::generate") {
 
@@ -15,4 +26,139 @@ TEST_CASE("ec::generate") {
 	CHECK( result == pair.pub );
 
 	libeosio::ec_shutdown();
-}
\ No newline at end of file
+}
+
+TEST_CASE("ec::generate [distinct]") {
+
+	std::set<libeosio::ec_privkey_t> keys;
+
+	for (int i = 0; i < 1000; i++) {
+		libeosio::ec_privkey_t priv;
+		REQUIRE( libeosio::ec_generate_privkey(&priv) == 0 );
+		keys.insert(priv);
+	}
+
+	CHECK( keys.size() == 1000 );
+}
+
+TEST_CASE("ec::ec_context::set_randomize_interval") {
+
+	const size_t intervals[] = { 0, 1, 3, EC_RANDOMIZE_INTERVAL };
+
+	for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+		libeosio::ec_context ctx;
+
+		SUBCASE(std::to_string(intervals[i]).c_str()) {
+			ctx.set_randomize_interval(intervals[i]);
+
+			for (int j = 0; j < 10; j++) {
+				libeosio::ec_keypair pair;
+				libeosio::ec_pubkey_t pub;
+
+				REQUIRE( ctx.generate_key(&pair) == 0 );
+				CHECK( ctx.get_publickey(&pair.secret, &pub) == 0 );
+				CHECK( pub == pair.pub );
+			}
+		}
+	}
+}
+
+#if defined(LIBEOSIO_EC_LIBSECP256K1)
+TEST_CASE("ec::chacha20_block") {
+
+	// RFC 8439 section 2.3.2. The 32-bit block count and 96-bit nonce of the RFC
+	// are the 64-bit counter and nonce words here.
+	uint32_t key[8];
+	unsigned char out[64];
+	const unsigned char expected[64] = {
+		0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd, 0x1f, 0xa3, 0x20, 0x71, 0xc4,
+		0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0, 0x68, 0x03, 0x04, 0x22, 0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e,
+		0xd2, 0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa, 0x09, 0x14, 0xc2, 0xd7, 0x05, 0xd9, 0x8b, 0x02, 0xa2,
+		0xb5, 0x12, 0x9c, 0xd1, 0xde, 0x16, 0x4e, 0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e
+	};
+
+	// 00:01:02:...:1f
+	for (uint32_t i = 0; i < 8; i++) {
+		key[i] = (i * 4) | (i * 4 + 1) << 8 | (i * 4 + 2) << 16 | (i * 4 + 3) << 24;
+	}
+
+	libeosio::internal::chacha20_block(key, 0x0900000000000001ULL, 0x4a000000ULL, out);
+	CHECK( memcmp(out, expected, sizeof(expected)) == 0 );
+}
+
+static unsigned _seed_calls = 0;
+
+static bool _counting_seed(unsigned char *out, size_t len) {
+	memset(out, (int) ++_seed_calls, len);
+	return true;
+}
+
+static bool _failing_seed(unsigned char *, size_t) {
+	return false;
+}
+
+TEST_CASE("ec::chacha20_drbg [reseed]") {
+
+	libeosio::internal::chacha20_drbg drbg(_counting_seed);
+	std::vector<unsigned char> buf(64 * 1024);
+
+	_seed_calls = 0;
+	REQUIRE( drbg.fill(buf.data(), 1) );
+	CHECK( _seed_calls == 1 );
+
+	// Reseeded once DRBG_RESEED_BYTES have been handed out, not before.
+	size_t total = 1;
+	while (total + buf.size() <= DRBG_RESEED_BYTES) {
+		REQUIRE( drbg.fill(buf.data(), buf.size()) );
+		total += buf.size();
+	}
+	REQUIRE( drbg.fill(buf.data(), DRBG_RESEED_BYTES - total) );
+	CHECK( _seed_calls == 1 );
+
+	REQUIRE( drbg.fill(buf.data(), 1) );
+	CHECK( _seed_calls == 2 );
+}
+
+TEST_CASE("ec::chacha20_drbg [seed failure]") {
+
+	libeosio::internal::chacha20_drbg drbg(_failing_seed);
+	unsigned char buf[32];
+
+	CHECK_FALSE( drbg.fill(buf, sizeof(buf)) );
+}
+
+#if !defined(_WIN32)
+TEST_CASE("ec::chacha20_drbg [fork]") {
+
+	libeosio::internal::chacha20_drbg drbg(_counting_seed);
+	unsigned char parent[32], child[32];
+	int fds[2], status = -1;
+
+	_seed_calls = 0;
+	REQUIRE( drbg.fill(parent, sizeof(parent)) );
+	REQUIRE( pipe(fds) == 0 );
+
+	pid_t pid = fork();
+	REQUIRE( pid >= 0 );
+
+	if (pid == 0) {
+		// Child: must reseed instead of continuing the stream of the parent.
+		bool ok = drbg.fill(child, sizeof(child)) && _seed_calls == 2;
+		ok = ok && write(fds[1], child, sizeof(child)) == (ssize_t) sizeof(child);
+		_exit(ok ? 0 : 1);
+	}
+
+	close(fds[1]);
+	REQUIRE( read(fds[0], child, sizeof(child)) == (ssize_t) sizeof(child) );
+	close(fds[0]);
+	REQUIRE( waitpid(pid, &status, 0) == pid );
+	CHECK( WIFEXITED(status) );
+	CHECK( WEXITSTATUS(status) == 0 );
+
+	// The parent continues without reseeding, and differs from the child.
+	REQUIRE( drbg.fill(parent, sizeof(parent)) );
+	CHECK( _seed_calls == 1 );
+	CHECK( memcmp(parent, child, sizeof(child)) != 0 );
+}
+#endif
+#endif
@@ -0,0 +1,111 @@
+#include <libeosio/ec.hpp>
+#include <vector>
+#include <doctest.h>
+
+// Order of the secp256k1 group minus `v` (v < 0x41).
+static libeosio::ec_privkey_t _order_minus(unsigned char v) {
+	libeosio::ec_privkey_t k = {
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+		0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41
+	};
+	k[31] -= v;
+	return k;
+}
+
+// a + 1 == b
+static bool _next(libeosio::ec_privkey_t a, const libeosio::ec_privkey_t& b) {
+	for (int i = 31; i >= 0 && ++a[i] == 0; i--);
+	return a == b;
+}
+
+TEST_CASE("ec::generate_keys_sequential") {
+
+	// Spans more than one batch.
+	std::vector<libeosio::ec_keypair> pairs(5000);
+
+	REQUIRE( libeosio::ec_generate_keys_sequential(pairs.data(), pairs.size()) == 0 );
+
+	for (size_t i = 0; i < pairs.size(); i++) {
+		libeosio::ec_pubkey_t pub;
+
+		CHECK( libeosio::ec_get_publickey(&pairs[i].secret, &pub) == 0 );
+		CHECK( pub == pairs[i].pub );
+		if (i > 0) {
+			CHECK( _next(pairs[i - 1].secret, pairs[i].secret) );
+		}
+	}
+
+	// Random base.
+	libeosio::ec_keypair other;
+	REQUIRE( libeosio::ec_generate_keys_sequential(&other, 1) == 0 );
+	CHECK( other.secret != pairs[0].secret );
+
+	CHECK( libeosio::ec_generate_keys_sequential(NULL, 0) == 0 );
+}
+
+TEST_CASE("ec::derive_keys_sequential") {
+
+	libeosio::ec_privkey_t one = { 0 };
+	one[31] = 1;
+
+	SUBCASE("generator") {
+		const libeosio::ec_pubkey_t g = {
+			0x02,
+			0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07,
+			0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98
+		};
+		libeosio::ec_keypair pairs[3];
+
+		REQUIRE( libeosio::ec_derive_keys_sequential(one, 0, pairs, 3) == 0 );
+		CHECK( pairs[0].secret == one );
+		CHECK( pairs[0].pub == g );
+
+		// offset
+		libeosio::ec_keypair pair;
+		REQUIRE( libeosio::ec_derive_keys_sequential(one, 2, &pair, 1) == 0 );
+		CHECK( pair.secret == pairs[2].secret );
+		CHECK( pair.pub == pairs[2].pub );
+	}
+
+	SUBCASE("split range") {
+		libeosio::ec_privkey_t base;
+		std::vector<libeosio::ec_keypair> all(3000), parts(3000);
+
+		REQUIRE( libeosio::ec_generate_privkey(&base) == 0 );
+		REQUIRE( libeosio::ec_derive_keys_sequential(base, 0, all.data(), all.size()) == 0 );
+		REQUIRE( libeosio::ec_derive_keys_sequential(base, 0, parts.data(), 1000) == 0 );
+		REQUIRE( libeosio::ec_derive_keys_sequential(base, 1000, parts.data() + 1000, 2000) == 0 );
+
+		for (size_t i = 0; i < all.size(); i++) {
+			CHECK( all[i].secret == parts[i].secret );
+			CHECK( all[i].pub == parts[i].pub );
+		}
+	}
+
+	SUBCASE("order wraps") {
+		libeosio::ec_keypair pairs[3];
+		libeosio::ec_pubkey_t pub;
+
+		// n - 2, n - 1 are valid, n is zero.
+		REQUIRE( libeosio::ec_derive_keys_sequential(_order_minus(2), 0, pairs, 2) == 0 );
+		CHECK( pairs[1].secret == _order_minus(1) );
+		CHECK( libeosio::ec_get_publickey(&pairs[1].secret, &pub) == 0 );
+		CHECK( pub == pairs[1].pub );
+
+		CHECK( libeosio::ec_derive_keys_sequential(_order_minus(2), 0, pairs, 3) == -1 );
+		CHECK( libeosio::ec_derive_keys_sequential(_order_minus(2), 2, pairs, 1) == -1 );
+
+		// Offset wraps past the order.
+		REQUIRE( libeosio::ec_derive_keys_sequential(_order_minus(1), 2, pairs, 1) == 0 );
+		CHECK( pairs[0].secret == one );
+	}
+
+	SUBCASE("invalid base") {
+		libeosio::ec_keypair pair;
+		libeosio::ec_privkey_t zero = { 0 };
+
+		CHECK( libeosio::ec_derive_keys_sequential(zero, 0, &pair, 1) == -1 );
+		CHECK( libeosio::ec_derive_keys_sequential(zero, 1, &pair, 1) == -1 );
+		CHECK( libeosio::ec_derive_keys_sequential(_order_minus(0), 0, &pair, 1) == -1 );
+	}
+}
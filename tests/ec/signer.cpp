@@ -0,0 +1,77 @@
+#include <libeosio/ec.hpp>
+#include <libeosio/hash.hpp>
+#include <vector>
+#include <doctest.h>
+
+TEST_CASE("ec::signer") {
+
+	libeosio::ec_keypair pair;
+	libeosio::ec_signer signer;
+	libeosio::sha256_t digest = { 0 };
+	libeosio::ec_signature_t sig;
+	libeosio::ec_pubkey_t pub;
+
+	libeosio::ec_init();
+	REQUIRE( libeosio::ec_generate_key(&pair) == 0 );
+
+	SUBCASE("sign") {
+		REQUIRE( signer.set_key(pair.secret) == 0 );
+		CHECK( signer.valid() );
+		CHECK( signer.pubkey() == pair.pub );
+
+		for (std::size_t i = 0; i < 20; i++) {
+			libeosio::sha256((const unsigned char*) &i, sizeof(i), &digest);
+			REQUIRE( signer.sign(&digest, sig) == 0 );
+			CHECK( libeosio::ecdsa_verify(&digest, sig, pair.pub) == 0 );
+			REQUIRE( libeosio::ecdsa_recover(&digest, sig, pub) == 0 );
+			CHECK( pub == pair.pub );
+
+			// Deterministic nonces, same signature as the one shot function.
+			if (libeosio::ec_get_backend() == libeosio::EC_BACKEND_LIBSECP256K1) {
+				libeosio::ec_signature_t expected;
+				REQUIRE( libeosio::ecdsa_sign(pair.secret, &digest, expected) == 0 );
+				CHECK( sig == expected );
+			}
+		}
+	}
+
+	SUBCASE("sign_many") {
+		std::vector<libeosio::sha256_t> digests(50);
+		std::vector<libeosio::ec_signature_t> sigs(50);
+
+		for (std::size_t i = 0; i < digests.size(); i++) {
+			libeosio::sha256((const unsigned char*) &i, sizeof(i), &digests[i]);
+		}
+
+		REQUIRE( signer.set_key(pair.secret) == 0 );
+		REQUIRE( signer.sign_many(digests.data(), digests.size(), sigs.data()) == 0 );
+
+		for (std::size_t i = 0; i < digests.size(); i++) {
+			CHECK( libeosio::ecdsa_verify(&digests[i], sigs[i], pair.pub) == 0 );
+		}
+	}
+
+	SUBCASE("invalid key") {
+		libeosio::ec_privkey_t zero = { 0 };
+		libeosio::ec_privkey_t order = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+			0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41
+		};
+
+		CHECK( !signer.valid() );
+		CHECK( signer.sign(&digest, sig) == -1 );
+
+		CHECK( signer.set_key(zero) == -1 );
+		CHECK( !signer.valid() );
+		CHECK( signer.set_key(order) == -1 );
+		CHECK( signer.sign(&digest, sig) == -1 );
+
+		// A failed set_key() unloads the previous key.
+		REQUIRE( signer.set_key(pair.secret) == 0 );
+		CHECK( signer.set_key(zero) == -1 );
+		CHECK( !signer.valid() );
+		CHECK( signer.pubkey() == libeosio::ec_pubkey_t() );
+	}
+
+	libeosio::ec_shutdown();
+}
@@ -0,0 +1,173 @@
+#include <libeosio/hash.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "hash/transform.hpp"
+#include "cpu.hpp"
+
+// Messages with deterministic content and lengths, `count` of them up to `max_len` bytes.
+struct batch_input {
+	std::vector<std::vector<unsigned char>> messages;
+	std::vector<const unsigned char*> data;
+	std::vector<size_t> len;
+
+	batch_input(size_t count, size_t max_len) : messages(count), data(count), len(count) {
+		uint32_t x = 0x12345678;
+
+		for (size_t i = 0; i < count; i++) {
+			x = x * 1103515245 + 12345;
+			messages[i].resize(max_len ? (x >> 8) % (max_len + 1) : 0);
+			for (size_t j = 0; j < messages[i].size(); j++) {
+				x = x * 1103515245 + 12345;
+				messages[i][j] = x >> 24;
+			}
+			data[i] = messages[i].data();
+			len[i] = messages[i].size();
+		}
+	}
+};
+
+TEST_CASE("hash::sha256_batch") {
+
+	const size_t counts[] = { 0, 1, 3, 8, 17, 100 };
+	const size_t lengths[] = { 0, 33, 55, 56, 64, 300 };
+
+	for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+		for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+			batch_input in(counts[c], lengths[l]);
+			std::vector<libeosio::sha256_t> out(counts[c] + 1);
+
+			SUBCASE((std::to_string(counts[c]) + " x " + std::to_string(lengths[l])).c_str()) {
+				libeosio::sha256_batch(in.data.data(), in.len.data(), counts[c], out.data());
+
+				for (size_t i = 0; i < counts[c]; i++) {
+					libeosio::sha256_t expected;
+					libeosio::sha256(in.data[i], in.len[i], &expected);
+					CHECK( memcmp(out[i], expected, sizeof(expected)) == 0 );
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("hash::sha256_batch [same length]") {
+
+	// All lanes finish at the same time.
+	std::vector<unsigned char> msg(64 * 3 + 10, 0x5a);
+	std::vector<const unsigned char*> data(40, msg.data());
+	std::vector<size_t> len(40, msg.size());
+	std::vector<libeosio::sha256_t> out(40);
+	libeosio::sha256_t expected;
+
+	libeosio::sha256(msg.data(), msg.size(), &expected);
+	libeosio::sha256_batch(data.data(), len.data(), data.size(), out.data());
+
+	for (size_t i = 0; i < out.size(); i++) {
+		CHECK( memcmp(out[i], expected, sizeof(expected)) == 0 );
+	}
+}
+
+TEST_CASE("hash::sha256d_batch") {
+
+	batch_input in(77, 200);
+	std::vector<libeosio::sha256_t> out(in.data.size());
+
+	libeosio::sha256d_batch(in.data.data(), in.len.data(), in.data.size(), out.data());
+
+	for (size_t i = 0; i < in.data.size(); i++) {
+		libeosio::sha256_t expected;
+		libeosio::sha256d(in.data[i], in.len[i], &expected);
+		CHECK( memcmp(out[i], expected, sizeof(expected)) == 0 );
+	}
+}
+
+TEST_CASE("hash::ripemd160_batch") {
+
+	const size_t counts[] = { 0, 1, 3, 8, 17, 100 };
+	const size_t lengths[] = { 0, 33, 55, 56, 64, 300 };
+
+	for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+		for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+			batch_input in(counts[c], lengths[l]);
+			std::vector<libeosio::ripemd160_t> out(counts[c] + 1);
+
+			SUBCASE((std::to_string(counts[c]) + " x " + std::to_string(lengths[l])).c_str()) {
+				libeosio::ripemd160_batch(in.data.data(), in.len.data(), counts[c], out.data());
+
+				for (size_t i = 0; i < counts[c]; i++) {
+					libeosio::ripemd160_t expected;
+					libeosio::ripemd160(in.data[i], in.len[i], &expected);
+					CHECK( memcmp(out[i], expected, sizeof(expected)) == 0 );
+				}
+			}
+		}
+	}
+}
+
+// Every compiled multi-buffer kernel is checked against the scalar transform,
+// not only the one selected for the running cpu. Each lane gets its own block
+// and starting state, and the kernel is run for a few blocks in a row.
+static void _check_kernel(libeosio::internal::hash_batch_kernel_t kernel, size_t lanes, size_t words,
+	const uint32_t *iv, void (*transform)(uint32_t *, const unsigned char *, size_t)) {
+
+	std::vector<unsigned char> data(lanes * 64 * 3);
+	std::vector<uint32_t> state(words * lanes), expected(words * lanes);
+	const unsigned char *blocks[HASH_BATCH_MAX_LANES];
+	uint32_t x = 0x0badf00d;
+
+	for (size_t i = 0; i < data.size(); i++) {
+		x = x * 1103515245 + 12345;
+		data[i] = x >> 24;
+	}
+
+	for (size_t k = 0; k < lanes; k++) {
+		for (size_t i = 0; i < words; i++) {
+			state[i * lanes + k] = iv[i] + (uint32_t) k;
+			expected[k * words + i] = iv[i] + (uint32_t) k;
+		}
+	}
+
+	for (size_t b = 0; b < 3; b++) {
+		for (size_t k = 0; k < lanes; k++) {
+			blocks[k] = &data[(b * lanes + k) * 64];
+			transform(&expected[k * words], blocks[k], 1);
+		}
+		kernel(state.data(), blocks);
+	}
+
+	for (size_t k = 0; k < lanes; k++) {
+		for (size_t i = 0; i < words; i++) {
+			CHECK( state[i * lanes + k] == expected[k * words + i] );
+		}
+	}
+}
+
+#if defined(LIBEOSIO_SIMD_X86)
+TEST_CASE("hash::batch kernels [sse41]") {
+	if (libeosio::internal::cpu_get_features().sse41) {
+		_check_kernel(libeosio::internal::sha256_batch_sse41, 4, 8,
+			libeosio::internal::sha256_initial_state, libeosio::internal::sha256_transform_generic);
+		_check_kernel(libeosio::internal::ripemd160_batch_sse41, 4, 5,
+			libeosio::internal::ripemd160_initial_state, libeosio::internal::ripemd160_transform);
+	}
+}
+
+TEST_CASE("hash::batch kernels [avx2]") {
+	if (libeosio::internal::cpu_get_features().avx2) {
+		_check_kernel(libeosio::internal::sha256_batch_avx2, 8, 8,
+			libeosio::internal::sha256_initial_state, libeosio::internal::sha256_transform_generic);
+		_check_kernel(libeosio::internal::ripemd160_batch_avx2, 8, 5,
+			libeosio::internal::ripemd160_initial_state, libeosio::internal::ripemd160_transform);
+	}
+}
+
+TEST_CASE("hash::batch kernels [avx512]") {
+	if (libeosio::internal::cpu_get_features().avx512bw) {
+		_check_kernel(libeosio::internal::sha256_batch_avx512, 16, 8,
+			libeosio::internal::sha256_initial_state, libeosio::internal::sha256_transform_generic);
+		_check_kernel(libeosio::internal::ripemd160_batch_avx512, 16, 5,
+			libeosio::internal::ripemd160_initial_state, libeosio::internal::ripemd160_transform);
+	}
+}
+#endif
@@ -0,0 +1,76 @@
+#include <libeosio/hash.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "test_helpers.hpp"
+
+struct ripemd160_testcase {
+	const char* name;
+	std::string in;
+	std::string expected;
+};
+
+static const std::vector<ripemd160_testcase> ripemd160_tests = {
+	{ "empty", "", "9c1185a5c5e9fc54612808977ee8f548b2258d31" },
+	{ "abc", "abc", "8eb208f7e05d987a9b044a8e98c6b087f15a0bfc" },
+	{ "two blocks", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "12a053384a9c0c88e405a06c27dcf49ada62eb2b" },
+	{ "million", std::string(1000000, 'a'), "52783243c1697bdbe16d37f97f68f08325dc1528" },
+};
+
+TEST_CASE("hash::ripemd160") {
+
+	for (auto it = ripemd160_tests.begin(); it != ripemd160_tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			libeosio::ripemd160_t out;
+			libeosio::ripemd160((const unsigned char*) it->in.data(), it->in.size(), &out);
+			CHECK( to_hex(out, sizeof(out)) == it->expected );
+		}
+	}
+}
+
+TEST_CASE("hash::ripemd160_update") {
+
+	for (auto it = ripemd160_tests.begin(); it != ripemd160_tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			const unsigned char* data = (const unsigned char*) it->in.data();
+			libeosio::ripemd160_ctx_t ctx;
+			libeosio::ripemd160_t out;
+
+			SUBCASE("one update") {
+				libeosio::ripemd160_init(&ctx);
+				libeosio::ripemd160_update(&ctx, data, it->in.size());
+			}
+
+			SUBCASE("odd sized updates") {
+				libeosio::ripemd160_init(&ctx);
+				for (size_t i = 0, n = 1; i < it->in.size(); i += n, n = n * 2 + 1) {
+					libeosio::ripemd160_update(&ctx, data + i, std::min(n, it->in.size() - i));
+				}
+			}
+
+			libeosio::ripemd160_final(&ctx, &out);
+			CHECK( to_hex(out, sizeof(out)) == it->expected );
+		}
+	}
+}
+
+TEST_CASE("hash::ripemd160_ctx_t [copy]") {
+
+	const std::string in = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	libeosio::ripemd160_ctx_t prefix, ctx;
+	libeosio::ripemd160_t out;
+
+	libeosio::ripemd160_init(&prefix);
+	libeosio::ripemd160_update(&prefix, (const unsigned char*) in.data(), 40);
+
+	// Finish the same prefix twice.
+	for (int i = 0; i < 2; i++) {
+		ctx = prefix;
+		libeosio::ripemd160_update(&ctx, (const unsigned char*) in.data() + 40, in.size() - 40);
+		libeosio::ripemd160_final(&ctx, &out);
+		CHECK( to_hex(out, sizeof(out)) == "12a053384a9c0c88e405a06c27dcf49ada62eb2b" );
+	}
+}
@@ -0,0 +1,134 @@
+#include <libeosio/hash.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <doctest.h>
+#include "test_helpers.hpp"
+#include "hash/transform.hpp"
+#include "cpu.hpp"
+
+struct sha256_testcase {
+	const char* name;
+	std::string in;
+	std::string expected;
+};
+
+static const std::vector<sha256_testcase> sha256_tests = {
+	{ "empty", "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+	{ "abc", "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+	{ "two blocks", "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+	{ "million", std::string(1000000, 'a'), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+};
+
+TEST_CASE("hash::sha256") {
+
+	for (auto it = sha256_tests.begin(); it != sha256_tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			libeosio::sha256_t out;
+			libeosio::sha256((const unsigned char*) it->in.data(), it->in.size(), &out);
+			CHECK( to_hex(out, sizeof(out)) == it->expected );
+		}
+	}
+}
+
+TEST_CASE("hash::sha256_update") {
+
+	for (auto it = sha256_tests.begin(); it != sha256_tests.end(); it++) {
+
+		SUBCASE(it->name) {
+			const unsigned char* data = (const unsigned char*) it->in.data();
+			libeosio::sha256_ctx_t ctx;
+			libeosio::sha256_t out;
+
+			SUBCASE("one update") {
+				libeosio::sha256_init(&ctx);
+				libeosio::sha256_update(&ctx, data, it->in.size());
+			}
+
+			SUBCASE("odd sized updates") {
+				libeosio::sha256_init(&ctx);
+				for (size_t i = 0, n = 1; i < it->in.size(); i += n, n = n * 2 + 1) {
+					libeosio::sha256_update(&ctx, data + i, std::min(n, it->in.size() - i));
+				}
+			}
+
+			libeosio::sha256_final(&ctx, &out);
+			CHECK( to_hex(out, sizeof(out)) == it->expected );
+		}
+	}
+}
+
+TEST_CASE("hash::sha256_ctx_t [copy]") {
+
+	const std::string in = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	libeosio::sha256_ctx_t prefix, ctx;
+	libeosio::sha256_t out;
+
+	libeosio::sha256_init(&prefix);
+	libeosio::sha256_update(&prefix, (const unsigned char*) in.data(), 40);
+
+	// Finish the same prefix twice.
+	for (int i = 0; i < 2; i++) {
+		ctx = prefix;
+		libeosio::sha256_update(&ctx, (const unsigned char*) in.data() + 40, in.size() - 40);
+		libeosio::sha256_final(&ctx, &out);
+		CHECK( to_hex(out, sizeof(out)) == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" );
+	}
+}
+
+TEST_CASE("hash::sha256d") {
+
+	libeosio::sha256_t out;
+
+	libeosio::sha256d((const unsigned char*) "abc", 3, &out);
+	CHECK( to_hex(out, sizeof(out)) == "4f8b42c22dd3729b519ba6f68d2da7cc5b2d606d05daed5ad5128cc03e6c6358" );
+}
+
+// Every compiled transform is checked, not only the one selected for the running cpu.
+static void _check_transform(libeosio::internal::sha256_transform_t transform) {
+
+	// "abc" as a single padded block.
+	unsigned char block[64] = { 'a', 'b', 'c', 0x80 };
+	const uint32_t abc[8] = {
+		0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223,
+		0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad
+	};
+	uint32_t state[8];
+
+	block[63] = 24;
+	memcpy(state, libeosio::internal::sha256_initial_state, sizeof(state));
+	transform(state, block, 1);
+	CHECK( memcmp(state, abc, sizeof(abc)) == 0 );
+
+	// Several blocks in one call against the generic transform.
+	std::vector<unsigned char> data(64 * 9);
+	uint32_t expected[8];
+	uint32_t x = 0x13579bdf;
+
+	for (size_t i = 0; i < data.size(); i++) {
+		x = x * 1103515245 + 12345;
+		data[i] = x >> 24;
+	}
+
+	for (size_t blocks = 0; blocks <= 9; blocks++) {
+		memcpy(state, libeosio::internal::sha256_initial_state, sizeof(state));
+		memcpy(expected, libeosio::internal::sha256_initial_state, sizeof(expected));
+		transform(state, data.data(), blocks);
+		libeosio::internal::sha256_transform_generic(expected, data.data(), blocks);
+		CHECK( memcmp(state, expected, sizeof(expected)) == 0 );
+	}
+}
+
+TEST_CASE("hash::sha256_transform [generic]") {
+	_check_transform(libeosio::internal::sha256_transform_generic);
+}
+
+#if defined(LIBEOSIO_SIMD_X86)
+TEST_CASE("hash::sha256_transform [shani]") {
+	if (libeosio::internal::cpu_get_features().sha) {
+		_check_transform(libeosio::internal::sha256_transform_shani);
+	}
+}
+#endif
@@ -0,0 +1,45 @@
+#ifndef LIBEOSIO_TEST_HELPERS_H
+#define LIBEOSIO_TEST_HELPERS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Input for the base58 classify kernel tests. Every compiled kernel is checked against
+ * the scalar one, not only the one selected for the running cpu.
+ *
+ * Strings of every length up to 200 (covering the SIMD tails), base58 characters
+ * with other bytes mixed in, 1 in 16 for even lengths and 1 in 256 for odd ones.
+ */
+inline std::vector<std::string> base58_kernel_inputs() {
+	const std::string alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+	std::vector<std::string> inputs;
+	uint32_t x = 0x2468ace0;
+
+	for (size_t len = 0; len <= 200; len++) {
+		std::string str(len, '1');
+
+		for (size_t i = 0; i < len; i++) {
+			x = x * 1103515245 + 12345;
+			str[i] = (x >> 24) < (len % 2 ? 1u : 16u) ? (char) (x >> 8) : alphabet[(x >> 8) % alphabet.size()];
+		}
+		inputs.push_back(str);
+	}
+	return inputs;
+}
+
+/**
+ * Lower case hex encoding of `len` bytes.
+ */
+inline std::string to_hex(const unsigned char* data, size_t len) {
+	static const char* digits = "0123456789abcdef";
+	std::string out;
+	for (size_t i = 0; i < len; i++) {
+		out += digits[data[i] >> 4];
+		out += digits[data[i] & 0xf];
+	}
+	return out;
+}
+
+#endif /* LIBEOSIO_TEST_HELPERS_H */
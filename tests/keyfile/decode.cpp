@@ -0,0 +1,131 @@
+#include <libeosio/WIF.hpp>
+#include <libeosio/keyfile.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <doctest.h>
+
+static libeosio::ec_pubkey_t _pubkey(size_t i) {
+	libeosio::ec_pubkey_t key;
+	key[0] = 0x02 + (i & 1);
+	for (size_t j = 1; j < key.size(); j++) {
+		key[j] = (unsigned char) (i * 131 + j * 17 + (i >> 8));
+	}
+	return key;
+}
+
+static libeosio::ec_signature_t _signature(size_t i) {
+	libeosio::ec_signature_t sig;
+	sig[0] = 0x1f + (i & 1);
+	for (size_t j = 1; j < sig.size(); j++) {
+		sig[j] = (unsigned char) (i * 7 + j * 29 + (i >> 8));
+	}
+	return sig;
+}
+
+// Every 7th line is invalid, every 11th line is empty and every 5th line ends with "\r\n".
+static bool _valid(size_t i) {
+	return i % 7 != 3 && i % 11 != 5;
+}
+
+static std::string _pub_lines(size_t num) {
+	std::string data;
+	for (size_t i = 0; i < num; i++) {
+		std::string line = libeosio::wif_pub_encode(_pubkey(i), i % 2 ? libeosio::WIF_PUB_K1 : libeosio::WIF_PUB_LEG);
+		if (i % 7 == 3) {
+			line[10] = line[10] == 'a' ? 'b' : 'a';
+		}
+		if (i % 11 == 5) {
+			line.clear();
+		}
+		data += line;
+		data += i % 5 == 0 ? "\r\n" : "\n";
+	}
+	return data;
+}
+
+static void _check_pub(const std::vector<libeosio::ec_pubkey_t>& keys, const libeosio::wif_status_t& status, size_t num) {
+	REQUIRE( keys.size() == num );
+	REQUIRE( status.size() == (num + 63) / 64 );
+	for (size_t i = 0; i < num; i++) {
+		CHECK( libeosio::wif_status_ok(status, i) == _valid(i) );
+		CHECK( keys[i] == (_valid(i) ? _pubkey(i) : libeosio::ec_pubkey_t()) );
+	}
+}
+
+TEST_CASE("keyfile::wif_pub_decode_lines") {
+
+	const size_t num = 5001;
+	const std::string data = _pub_lines(num);
+	std::vector<libeosio::ec_pubkey_t> keys;
+	libeosio::wif_status_t status;
+
+	SUBCASE("single thread") {
+		libeosio::wif_pub_decode_lines(data.data(), data.size(), keys, status, 1);
+		_check_pub(keys, status, num);
+	}
+
+	SUBCASE("multiple threads") {
+		libeosio::wif_pub_decode_lines(data.data(), data.size(), keys, status, 3);
+		_check_pub(keys, status, num);
+	}
+
+	SUBCASE("no trailing newline") {
+		libeosio::wif_pub_decode_lines(data.data(), data.size() - 1, keys, status, 2);
+		_check_pub(keys, status, num);
+	}
+
+	SUBCASE("empty") {
+		libeosio::wif_pub_decode_lines(data.data(), 0, keys, status, 4);
+		CHECK( keys.size() == 0 );
+		CHECK( status.size() == 0 );
+	}
+}
+
+TEST_CASE("keyfile::wif_sig_decode_lines") {
+
+	const size_t num = 3000;
+	std::string data;
+	std::vector<libeosio::ec_signature_t> sigs;
+	libeosio::wif_status_t status;
+
+	for (size_t i = 0; i < num; i++) {
+		data += _valid(i) ? libeosio::wif_sig_encode(_signature(i)) : "SIG_K1_invalid";
+		data += "\n";
+	}
+
+	libeosio::wif_sig_decode_lines(data.data(), data.size(), sigs, status, 4);
+
+	REQUIRE( sigs.size() == num );
+	for (size_t i = 0; i < num; i++) {
+		CHECK( libeosio::wif_status_ok(status, i) == _valid(i) );
+		CHECK( sigs[i] == (_valid(i) ? _signature(i) : libeosio::ec_signature_t()) );
+	}
+}
+
+TEST_CASE("keyfile::wif_pub_decode_file") {
+
+	const size_t num = 2000;
+	const std::string filename = "libeosio_keyfile_test.txt";
+	std::vector<libeosio::ec_pubkey_t> keys;
+	libeosio::wif_status_t status;
+
+	SUBCASE("file") {
+		std::ofstream(filename.c_str(), std::ios::binary) << _pub_lines(num);
+		CHECK( libeosio::wif_pub_decode_file(filename, keys, status, 2) == 0 );
+		std::remove(filename.c_str());
+		_check_pub(keys, status, num);
+	}
+
+	SUBCASE("empty file") {
+		std::ofstream(filename.c_str(), std::ios::binary);
+		CHECK( libeosio::wif_pub_decode_file(filename, keys, status) == 0 );
+		std::remove(filename.c_str());
+		CHECK( keys.size() == 0 );
+	}
+
+	SUBCASE("missing file") {
+		CHECK( libeosio::wif_pub_decode_file("libeosio_no_such_file.txt", keys, status) == -1 );
+	}
+}
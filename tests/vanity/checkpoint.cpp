@@ -0,0 +1,190 @@
+#include <libeosio/vanity.hpp>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <doctest.h>
+#include "vanity/checkpoint.hpp"
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+using namespace libeosio;
+
+static std::set<uint64_t> _indexes(const std::vector<vanity_match_t>& matches) {
+	std::set<uint64_t> s;
+	for (size_t i = 0; i < matches.size(); i++) {
+		s.insert(matches[i].index);
+	}
+	return s;
+}
+
+TEST_CASE("vanity::checkpoint") {
+
+	const std::string filename = "libeosio_vanity_checkpoint.bin";
+	const std::vector<vanity_pattern_t> patterns = { { "ab", VANITY_ANYWHERE, 0 }, { "XY", VANITY_SUFFIX, VANITY_IGNORE_CASE } };
+	const uint64_t max_keys = 10 * VANITY_CHUNK_KEYS + 100;
+
+	ec_privkey_t base;
+	REQUIRE( ec_generate_privkey(&base) == 0 );
+
+	// Uninterrupted search.
+	vanity_search ref(patterns);
+	ref.set_base(base);
+	ref.set_threads(2);
+	ref.set_max_keys(max_keys);
+	REQUIRE( ref.run() == 0 );
+	std::set<uint64_t> expected = _indexes(ref.matches());
+	REQUIRE( expected.size() == ref.matches().size() );
+	REQUIRE( expected.size() > 10 );
+
+	SUBCASE("resume") {
+		std::atomic<int> calls(0);
+		vanity_search a(patterns);
+		a.set_base(base);
+		a.set_threads(2);
+		a.set_max_keys(max_keys);
+		a.on_match([&](const vanity_match_t& m) {
+			(void) m;
+			return ++calls < 5;
+		});
+		REQUIRE( a.run() == 0 );
+		REQUIRE( a.save_checkpoint(filename) == 0 );
+		CHECK( a.stats().keys < max_keys );
+
+		// Other thread count, only new keys are reported.
+		std::set<uint64_t> reported;
+		vanity_search b(patterns);
+		REQUIRE( b.load_checkpoint(filename) == 0 );
+		CHECK( b.base() == base );
+		CHECK( b.stats().keys == a.stats().keys );
+		CHECK( b.stats().matches == 5 );
+
+		b.set_threads(3);
+		b.set_max_keys(max_keys);
+		b.on_match([&](const vanity_match_t& m) {
+			CHECK( reported.insert(m.index).second );
+			return true;
+		});
+		REQUIRE( b.run() == 0 );
+
+		CHECK( b.stats().keys == max_keys );
+		CHECK( b.stats().matches == expected.size() );
+		CHECK( _indexes(b.matches()) == expected );
+		CHECK( reported.size() + 5 == expected.size() );
+		for (auto i : _indexes(a.matches())) {
+			CHECK( reported.count(i) == 0 );
+		}
+
+		std::remove(filename.c_str());
+	}
+
+	SUBCASE("run again") {
+		vanity_search a(patterns);
+		a.set_base(base);
+		a.set_threads(2);
+		a.set_max_keys(max_keys / 2);
+		REQUIRE( a.run() == 0 );
+		a.set_max_keys(max_keys);
+		REQUIRE( a.run() == 0 );
+
+		CHECK( a.stats().keys == max_keys );
+		CHECK( _indexes(a.matches()) == expected );
+	}
+
+	SUBCASE("periodic") {
+		vanity_search a(patterns);
+		a.set_base(base);
+		a.set_threads(2);
+		a.set_checkpoint(filename, 0.01);
+		a.set_max_keys(max_keys);
+		a.on_progress([&](const vanity_stats_t& st) {
+			// A checkpoint taken while running.
+			vanity_search b(patterns);
+			CHECK( b.load_checkpoint(filename) == 0 );
+			CHECK( b.stats().keys <= st.keys );
+			a.cancel();
+		}, 0.05);
+		REQUIRE( a.run() == 0 );
+
+		// Saved again when run() returned.
+		vanity_search b(patterns);
+		REQUIRE( b.load_checkpoint(filename) == 0 );
+		CHECK( b.stats().keys == a.stats().keys );
+		CHECK( _indexes(b.matches()) == _indexes(a.matches()) );
+
+		b.set_max_keys(max_keys);
+		REQUIRE( b.run() == 0 );
+		CHECK( _indexes(b.matches()) == expected );
+
+		std::remove(filename.c_str());
+	}
+
+	SUBCASE("invalid") {
+		REQUIRE( ref.save_checkpoint(filename) == 0 );
+
+		vanity_search ok(patterns);
+		CHECK( ok.load_checkpoint(filename) == 0 );
+		CHECK( ok.matches().size() == expected.size() );
+
+		vanity_search other({ { "ab", VANITY_ANYWHERE, 0 } });
+		CHECK( other.load_checkpoint(filename) == -1 );
+
+		vanity_search legacy(patterns, WIF_CODEC_LEG);
+		CHECK( legacy.load_checkpoint(filename) == -1 );
+
+		// Corrupt
+		std::string data;
+		{
+			std::ifstream in(filename.c_str(), std::ios::binary);
+			data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+		}
+		data[data.size() / 2] ^= 1;
+		std::ofstream(filename.c_str(), std::ios::binary) << data;
+
+		vanity_search corrupt(patterns);
+		CHECK( corrupt.load_checkpoint(filename) == -1 );
+
+		std::remove(filename.c_str());
+
+		vanity_search missing(patterns);
+		CHECK( missing.load_checkpoint(filename) == -1 );
+	}
+
+	SUBCASE("pattern index") {
+		internal::vanity_checkpoint cp;
+		REQUIRE( internal::vanity_checkpoint_read(filename, cp) == -1 );
+		REQUIRE( ref.save_checkpoint(filename) == 0 );
+		REQUIRE( internal::vanity_checkpoint_read(filename, cp) == 0 );
+
+		// A match of a pattern that is not in the file.
+		cp.matches[0].pattern = cp.patterns.size();
+		REQUIRE( internal::vanity_checkpoint_write(filename, cp) == 0 );
+		CHECK( internal::vanity_checkpoint_read(filename, cp) == -1 );
+
+		std::remove(filename.c_str());
+	}
+
+#if !defined(_WIN32)
+	SUBCASE("permissions") {
+		// A temporary file left behind with a wider mode.
+		const std::string tmp = filename + ".tmp";
+		std::ofstream(tmp.c_str()) << "stale";
+		REQUIRE( chmod(tmp.c_str(), 0644) == 0 );
+
+		REQUIRE( ref.save_checkpoint(filename) == 0 );
+
+		struct stat st;
+		REQUIRE( stat(filename.c_str(), &st) == 0 );
+		CHECK( (st.st_mode & 0777) == 0600 );
+		CHECK( stat(tmp.c_str(), &st) == -1 );
+
+		vanity_search b(patterns);
+		CHECK( b.load_checkpoint(filename) == 0 );
+
+		std::remove(filename.c_str());
+	}
+#endif
+}
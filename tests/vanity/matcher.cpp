@@ -0,0 +1,141 @@
+#include <libeosio/vanity.hpp>
+#include <cctype>
+#include <random>
+#include <doctest.h>
+
+using namespace libeosio;
+
+TEST_CASE("vanity::matcher") {
+
+	struct testcase {
+		const char* name;
+		std::vector<vanity_pattern_t> patterns;
+		const char* str;
+		int expected;
+	};
+
+	std::vector<testcase> tests = {
+		{ "anywhere", { { "eos", VANITY_ANYWHERE, 0 } }, "5abceosxyz", 0 },
+		{ "no match", { { "eos", VANITY_ANYWHERE, 0 } }, "5abcEosxyz", -1 },
+		{ "prefix", { { "5ab", VANITY_PREFIX, 0 } }, "5abceosxyz", 0 },
+		{ "prefix not at start", { { "abc", VANITY_PREFIX, 0 } }, "5abceosxyz", -1 },
+		{ "suffix", { { "xyz", VANITY_SUFFIX, 0 } }, "5abceosxyz", 0 },
+		{ "suffix not at end", { { "eos", VANITY_SUFFIX, 0 } }, "5abceosxyz", -1 },
+		{ "overlapping", { { "abcd", VANITY_ANYWHERE, 0 }, { "bc", VANITY_ANYWHERE, 0 } }, "5abceosxyz", 1 },
+		{ "lowest index", { { "xyz", VANITY_ANYWHERE, 0 }, { "5a", VANITY_ANYWHERE, 0 } }, "5abceosxyz", 0 },
+		{ "ignore case", { { "EOS", VANITY_ANYWHERE, VANITY_IGNORE_CASE } }, "5abcEoSxyz", 0 },
+		{ "ignore case L", { { "hello", VANITY_ANYWHERE, VANITY_IGNORE_CASE } }, "5HeLLoxyz", 0 },
+		{ "leet", { { "bees", VANITY_ANYWHERE, VANITY_LEET } }, "5ab33sxyz", 0 },
+		{ "leet pattern", { { "b33s", VANITY_ANYWHERE, VANITY_LEET } }, "58ee5xyz", 0 },
+		{ "leet case", { { "bees", VANITY_ANYWHERE, VANITY_LEET } }, "5aB33sxyz", -1 },
+		{ "leet ignore case", { { "hello", VANITY_ANYWHERE, VANITY_LEET | VANITY_IGNORE_CASE } }, "5HeLLoxyz5hELL0", 0 },
+		{ "mixed flags", {
+			{ "zzz", VANITY_ANYWHERE, 0 },
+			{ "s7", VANITY_SUFFIX, VANITY_LEET },
+			{ "XY", VANITY_ANYWHERE, VANITY_IGNORE_CASE },
+		}, "5abceosxyst", 1 },
+		{ "other characters", { { "ab", VANITY_ANYWHERE, 0 } }, "PUB_K1_ab", 0 },
+		{ "other characters break", { { "ab", VANITY_ANYWHERE, 0 } }, "a_b", -1 },
+	};
+
+	for (auto t : tests) {
+		SUBCASE(t.name) {
+			vanity_matcher m;
+			REQUIRE( m.compile(t.patterns) );
+			CHECK( m.match(t.str) == t.expected );
+		}
+	}
+}
+
+TEST_CASE("vanity::matcher invalid") {
+
+	std::vector<vanity_pattern_t> invalid[] = {
+		{},
+		{ { "", VANITY_ANYWHERE, 0 } },
+		{ { "0", VANITY_ANYWHERE, 0 } },
+		{ { "l", VANITY_ANYWHERE, 0 } },
+		{ { "abc", VANITY_ANYWHERE, 0 }, { "a_b", VANITY_ANYWHERE, VANITY_IGNORE_CASE } },
+		{ { std::string(60, 'a'), VANITY_ANYWHERE, 0 } },
+	};
+
+	for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+		vanity_matcher m;
+		CHECK_FALSE( m.compile(invalid[i]) );
+		CHECK( m.match("abc") == -1 );
+	}
+
+	// Valid when folded.
+	vanity_matcher m;
+	CHECK( m.compile({ { "0l", VANITY_ANYWHERE, VANITY_LEET | VANITY_IGNORE_CASE } }) );
+	CHECK( m.match("xoLx") == 0 );
+}
+
+// Reference: fold every character and search for the pattern at every position.
+static char _ref_fold(unsigned int flags, char c) {
+	if ((flags & VANITY_LEET) && c >= '0' && c <= '9') {
+		c = "oizeasgtbg"[c - '0'];
+	}
+	if ((flags & VANITY_IGNORE_CASE) && std::isalpha((unsigned char) c)) {
+		c = (char) std::tolower((unsigned char) c);
+	}
+	return c;
+}
+
+static bool _ref_match(const vanity_pattern_t& p, const std::string& str) {
+	for (size_t pos = 0; pos + p.text.size() <= str.size(); pos++) {
+		if ((p.position == VANITY_PREFIX && pos != 0)
+			|| (p.position == VANITY_SUFFIX && pos + p.text.size() != str.size())) {
+			continue;
+		}
+
+		size_t i = 0;
+		while (i < p.text.size() && _ref_fold(p.flags, p.text[i]) == _ref_fold(p.flags, str[pos + i])) {
+			i++;
+		}
+		if (i == p.text.size()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+TEST_CASE("vanity::matcher random") {
+
+	const std::string alphabet = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+	// Small alphabet so patterns actually match.
+	const std::string small = "123abeABE";
+	std::mt19937 rng(1234);
+
+	for (int round = 0; round < 200; round++) {
+		std::vector<vanity_pattern_t> patterns(1 + rng() % 12);
+		vanity_matcher m;
+
+		for (size_t i = 0; i < patterns.size(); i++) {
+			size_t len = 1 + rng() % 4;
+			for (size_t j = 0; j < len; j++) {
+				patterns[i].text += small[rng() % small.size()];
+			}
+			patterns[i].position = (vanity_position_t) (rng() % 3);
+			patterns[i].flags = rng() % 4;
+		}
+
+		REQUIRE( m.compile(patterns) );
+
+		for (int k = 0; k < 50; k++) {
+			std::string str;
+			int expected = -1;
+
+			for (size_t j = 0; j < 20; j++) {
+				str += (k % 2 ? alphabet : small)[rng() % (k % 2 ? alphabet.size() : small.size())];
+			}
+
+			for (size_t i = 0; i < patterns.size() && expected < 0; i++) {
+				if (_ref_match(patterns[i], str)) {
+					expected = (int) i;
+				}
+			}
+
+			CHECK( m.match(str) == expected );
+		}
+	}
+}
@@ -0,0 +1,191 @@
+#include <libeosio/vanity.hpp>
+#include <libeosio/WIF.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <doctest.h>
+
+using namespace libeosio;
+
+// Checks that `m` is a valid key that matches `pattern`.
+static void _check_match(const vanity_match_t& m, const vanity_pattern_t& pattern, const wif_codec_t& codec) {
+
+	ec_pubkey_t pub;
+	std::string b58 = m.pub.substr(codec.pub.size());
+	vanity_pattern_t p = pattern;
+
+	if (p.flags & VANITY_IGNORE_CASE) {
+		std::transform(b58.begin(), b58.end(), b58.begin(), ::tolower);
+		std::transform(p.text.begin(), p.text.end(), p.text.begin(), ::tolower);
+	}
+
+	REQUIRE( ec_get_publickey(&m.key.secret, &pub) == 0 );
+	CHECK( pub == m.key.pub );
+	CHECK( wif_pub_encode(pub, codec.pub) == m.pub );
+
+	switch (p.position) {
+	case VANITY_PREFIX:
+		CHECK( b58.compare(0, p.text.size(), p.text) == 0 );
+		break;
+	case VANITY_SUFFIX:
+		CHECK( b58.compare(b58.size() - p.text.size(), p.text.size(), p.text) == 0 );
+		break;
+	case VANITY_ANYWHERE:
+		CHECK( b58.find(p.text) != std::string::npos );
+		break;
+	}
+}
+
+TEST_CASE("vanity::search") {
+
+	struct testcase {
+		const char* name;
+		vanity_pattern_t pattern;
+		wif_codec_t codec;
+	};
+
+	std::vector<testcase> tests = {
+		{ "prefix", { "7a", VANITY_PREFIX, 0 }, WIF_CODEC_K1 },
+		{ "prefix legacy", { "6Z", VANITY_PREFIX, 0 }, WIF_CODEC_LEG },
+		{ "anywhere", { "eos", VANITY_ANYWHERE, 0 }, WIF_CODEC_K1 },
+		{ "suffix", { "Zz", VANITY_SUFFIX, 0 }, WIF_CODEC_LEG },
+		{ "ignore case", { "EOS", VANITY_ANYWHERE, VANITY_IGNORE_CASE }, WIF_CODEC_K1 },
+		{ "ignore case prefix", { "7AB", VANITY_PREFIX, VANITY_IGNORE_CASE }, WIF_CODEC_LEG },
+	};
+
+	for (auto t : tests) {
+		SUBCASE(t.name) {
+			vanity_search search({ t.pattern }, t.codec);
+			std::vector<vanity_match_t> matches;
+			std::mutex mutex;
+
+			search.set_threads(2);
+			search.set_max_matches(3);
+			search.on_match([&](const vanity_match_t& m) {
+				std::lock_guard<std::mutex> lock(mutex);
+				matches.push_back(m);
+				return true;
+			});
+
+			REQUIRE( search.run() == 0 );
+			REQUIRE( matches.size() == 3 );
+			CHECK( search.stats().matches == 3 );
+
+			for (size_t i = 0; i < matches.size(); i++) {
+				CHECK( matches[i].pattern == 0 );
+				_check_match(matches[i], t.pattern, t.codec);
+			}
+		}
+	}
+}
+
+TEST_CASE("vanity::search multiple patterns") {
+
+	std::vector<vanity_pattern_t> patterns = {
+		{ "8k", VANITY_PREFIX, 0 },
+		{ "5k", VANITY_PREFIX, 0 },
+		{ "zz", VANITY_ANYWHERE, 0 },
+	};
+	std::vector<size_t> hits(patterns.size(), 0);
+
+	vanity_search search(patterns);
+	search.set_threads(3);
+	search.set_max_keys(100000);
+	search.on_match([&](const vanity_match_t& m) {
+		REQUIRE( m.pattern < patterns.size() );
+		_check_match(m, patterns[m.pattern], WIF_CODEC_K1);
+		hits[m.pattern]++;
+		return true;
+	});
+
+	REQUIRE( search.run() == 0 );
+	CHECK( search.stats().keys == 100000 );
+	CHECK( hits[1] > 0 );
+	CHECK( hits[2] > 0 );
+}
+
+TEST_CASE("vanity::search sequence") {
+
+	ec_privkey_t base = { 0 };
+	base[31] = 42;
+
+	vanity_search search({ { "ab", VANITY_ANYWHERE, 0 } });
+	search.set_base(base);
+	search.set_threads(2);
+	search.set_max_keys(20000);
+	search.on_match([&](const vanity_match_t& m) {
+		struct ec_keypair pair;
+		REQUIRE( ec_derive_keys_sequential(base, m.index, &pair, 1) == 0 );
+		CHECK( pair.secret == m.key.secret );
+		return true;
+	});
+
+	REQUIRE( search.run() == 0 );
+	CHECK( search.base() == base );
+	CHECK( search.stats().keys == 20000 );
+	CHECK( search.stats().matches > 0 );
+}
+
+TEST_CASE("vanity::search stop") {
+
+	// Practically never matches.
+	vanity_search search({ { "zzzzzzzzzz", VANITY_ANYWHERE, 0 } });
+
+	search.set_threads(2);
+
+	SUBCASE("max keys") {
+		search.set_max_keys(VANITY_CHUNK_KEYS * 3 + 5);
+		REQUIRE( search.run() == 0 );
+		CHECK( search.stats().keys == VANITY_CHUNK_KEYS * 3 + 5 );
+	}
+
+	SUBCASE("timeout") {
+		search.set_timeout(0.2);
+		REQUIRE( search.run() == 0 );
+		CHECK( search.stats().seconds >= 0.2 );
+	}
+
+	SUBCASE("cancel from progress") {
+		std::atomic<int> reports(0);
+		search.on_progress([&](const vanity_stats_t& st) {
+			(void) st;
+			if (++reports == 2) {
+				search.cancel();
+			}
+		}, 0.05);
+		REQUIRE( search.run() == 0 );
+		CHECK( reports == 2 );
+	}
+
+	SUBCASE("match callback") {
+		vanity_search s({ { "a", VANITY_ANYWHERE, 0 } });
+		std::atomic<int> calls(0);
+		s.set_threads(2);
+		s.on_match([&](const vanity_match_t& m) {
+			(void) m;
+			return ++calls < 5;
+		});
+		REQUIRE( s.run() == 0 );
+		CHECK( calls == 5 );
+		CHECK( s.stats().matches == 5 );
+	}
+}
+
+TEST_CASE("vanity::search invalid patterns") {
+
+	std::vector<vanity_pattern_t> invalid[] = {
+		{},
+		{ { "", VANITY_ANYWHERE, 0 } },
+		{ { "0", VANITY_ANYWHERE, 0 } },
+		{ { "abc", VANITY_PREFIX, 0 }, { "l", VANITY_SUFFIX, 0 } },
+		// Public keys never start with these.
+		{ { "1", VANITY_PREFIX, 0 } },
+		{ { "z", VANITY_PREFIX, 0 } },
+	};
+
+	for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+		vanity_search search(invalid[i]);
+		CHECK( search.run() == -1 );
+	}
+}